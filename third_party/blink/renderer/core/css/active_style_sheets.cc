@@ -5,12 +5,14 @@
 #include "third_party/blink/renderer/core/css/active_style_sheets.h"
 
 #include "third_party/blink/renderer/core/css/css_style_sheet.h"
+#include "third_party/blink/renderer/core/css/media_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/resolver/scoped_style_resolver.h"
 #include "third_party/blink/renderer/core/css/rule_set.h"
 #include "third_party/blink/renderer/core/css/style_change_reason.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
 #include "third_party/blink/renderer/core/dom/container_node.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -141,15 +143,23 @@ bool HasMediaQueries(const ActiveStyleSheetVector& active_style_sheets) {
 }
 
 bool HasSizeDependentMediaQueries(
-    const ActiveStyleSheetVector& active_style_sheets) {
+    const ActiveStyleSheetVector& active_style_sheets,
+    const MediaQueryEvaluator& evaluator) {
   for (const auto& active_sheet : active_style_sheets) {
     if (active_sheet.first->HasMediaQueryResults())
       return true;
     StyleSheetContents* contents = active_sheet.first->Contents();
     if (!contents->HasRuleSet())
       continue;
-    if (contents->GetRuleSet().Features().HasMediaQueryResults())
-      return true;
+    const RuleSet& rule_set = contents->GetRuleSet();
+    if (!rule_set.Features().HasMediaQueryResults())
+      continue;
+    // Only crossing a media query breakpoint may require a new RuleSet.
+    if (RuntimeEnabledFeatures::CSSMediaQueryBreakpointIndexEnabled() &&
+        !rule_set.DidMediaQueryResultsChangeForResize(evaluator)) {
+      continue;
+    }
+    return true;
   }
   return false;
 }
@@ -174,9 +184,10 @@ bool HasDynamicViewportDependentMediaQueries(
 }  // namespace
 
 bool AffectedByMediaValueChange(const ActiveStyleSheetVector& active_sheets,
-                                MediaValueChange change) {
+                                MediaValueChange change,
+                                const MediaQueryEvaluator& evaluator) {
   if (change == MediaValueChange::kSize)
-    return HasSizeDependentMediaQueries(active_sheets);
+    return HasSizeDependentMediaQueries(active_sheets, evaluator);
   if (change == MediaValueChange::kDynamicViewport)
     return HasDynamicViewportDependentMediaQueries(active_sheets);
 
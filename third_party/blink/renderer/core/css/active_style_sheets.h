@@ -14,6 +14,7 @@
 namespace blink {
 
 class CSSStyleSheet;
+class MediaQueryEvaluator;
 class RuleSet;
 
 using ActiveStyleSheet = std::pair<Member<CSSStyleSheet>, Member<RuleSet>>;
@@ -31,7 +32,8 @@ CompareActiveStyleSheets(const ActiveStyleSheetVector& old_style_sheets,
                          HeapHashSet<Member<RuleSet>>& changed_rule_sets);
 
 bool AffectedByMediaValueChange(const ActiveStyleSheetVector& active_sheets,
-                                MediaValueChange change);
+                                MediaValueChange change,
+                                const MediaQueryEvaluator& evaluator);
 
 }  // namespace blink
 
@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/core/css/check_pseudo_has_cache_scope.h"
 
 #include "third_party/blink/renderer/core/css/check_pseudo_has_argument_context.h"
+#include "third_party/blink/renderer/core/css/check_pseudo_has_persistent_cache.h"
 #include "third_party/blink/renderer/core/css/css_selector.h"
 #include "third_party/blink/renderer/core/css/selector_checker.h"
 #include "third_party/blink/renderer/core/dom/document.h"
@@ -13,7 +14,9 @@
 
 namespace blink {
 
-CheckPseudoHasCacheScope::CheckPseudoHasCacheScope(Document* document)
+CheckPseudoHasCacheScope::CheckPseudoHasCacheScope(
+    Document* document,
+    CheckPseudoHasPersistentCache* persistent_cache)
     : document_(document) {
   DCHECK(document_);
 
@@ -21,29 +24,40 @@ CheckPseudoHasCacheScope::CheckPseudoHasCacheScope(Document* document)
     return;
 
   document_->SetCheckPseudoHasCacheScope(this);
+  persistent_cache_ = persistent_cache;
 }
 
 CheckPseudoHasCacheScope::~CheckPseudoHasCacheScope() {
   if (document_->GetCheckPseudoHasCacheScope() != this)
     return;
 
+  if (persistent_cache_)
+    persistent_cache_->Merge(result_cache_);
+
   document_->SetCheckPseudoHasCacheScope(nullptr);
 }
 
 // static
 ElementCheckPseudoHasResultMap& CheckPseudoHasCacheScope::GetResultMap(
     const Document* document,
-    const CSSSelector* selector) {
+    const CSSSelector* selector,
+    const ElementCheckPseudoHasResultMap*& persistent_result_map) {
   // To increase the cache hit ratio, we need to have a same cache key
   // for multiple selector instances those are actually has a same selector.
   // TODO(blee@igalia.com) Find a way to get hash key without serialization.
   String selector_text = selector->SelectorText();
 
   DCHECK(document);
-  DCHECK(document->GetCheckPseudoHasCacheScope());
+  CheckPseudoHasCacheScope* cache_scope =
+      document->GetCheckPseudoHasCacheScope();
+  DCHECK(cache_scope);
+
+  persistent_result_map =
+      cache_scope->persistent_cache_
+          ? cache_scope->persistent_cache_->GetResultMap(selector_text)
+          : nullptr;
 
-  auto entry = document->GetCheckPseudoHasCacheScope()->GetResultCache().insert(
-      selector_text, nullptr);
+  auto entry = cache_scope->GetResultCache().insert(selector_text, nullptr);
   if (entry.is_new_entry) {
     entry.stored_value->value =
         MakeGarbageCollected<ElementCheckPseudoHasResultMap>();
@@ -52,6 +66,13 @@ ElementCheckPseudoHasResultMap& CheckPseudoHasCacheScope::GetResultMap(
   return *entry.stored_value->value;
 }
 
+// static
+bool CheckPseudoHasCacheScope::PersistsResults(const Document* document) {
+  DCHECK(document);
+  DCHECK(document->GetCheckPseudoHasCacheScope());
+  return !!document->GetCheckPseudoHasCacheScope()->persistent_cache_;
+}
+
 // static
 ElementCheckPseudoHasFastRejectFilterMap&
 CheckPseudoHasCacheScope::GetFastRejectFilterMap(
@@ -82,7 +103,8 @@ CheckPseudoHasCacheScope::Context::Context(
     case CheckPseudoHasArgumentTraversalScope::kAllNextSiblings:
       cache_allowed_ = true;
       result_map_ = &CheckPseudoHasCacheScope::GetResultMap(
-          document, argument_context.HasArgument());
+          document, argument_context.HasArgument(), persistent_result_map_);
+      persist_results_ = CheckPseudoHasCacheScope::PersistsResults(document);
       fast_reject_filter_map_ =
           &CheckPseudoHasCacheScope::GetFastRejectFilterMap(
               document, argument_context.TraversalType());
@@ -100,7 +122,10 @@ CheckPseudoHasCacheScope::Context::SetMatchedAndGetOldResult(Element* element) {
 }
 
 void CheckPseudoHasCacheScope::Context::SetChecked(Element* element) {
-  SetResultAndGetOld(element, kCheckPseudoHasResultChecked);
+  SetResultAndGetOld(element, persist_results_
+                                  ? kCheckPseudoHasResultChecked |
+                                        kCheckPseudoHasResultAnchorChecked
+                                  : kCheckPseudoHasResultChecked);
 }
 
 CheckPseudoHasResult CheckPseudoHasCacheScope::Context::SetResultAndGetOld(
@@ -203,10 +228,24 @@ CheckPseudoHasResult CheckPseudoHasCacheScope::Context::GetResult(
   DCHECK(cache_allowed_);
   DCHECK(result_map_);
   auto iterator = result_map_->find(element);
-  return iterator == result_map_->end() ? kCheckPseudoHasResultNotCached
+  return iterator == result_map_->end() ? GetPersistentResult(element)
                                         : iterator->value;
 }
 
+CheckPseudoHasResult CheckPseudoHasCacheScope::Context::GetPersistentResult(
+    Element* element) const {
+  // The persisted results are only used for the results of the elements
+  // themselves. They are not taken into account when setting results in the
+  // scope, so that the matched ancestors of a newly matched element are
+  // always marked as matched in the scope.
+  if (!persistent_result_map_)
+    return kCheckPseudoHasResultNotCached;
+  auto iterator = persistent_result_map_->find(element);
+  return iterator == persistent_result_map_->end()
+             ? kCheckPseudoHasResultNotCached
+             : iterator->value;
+}
+
 bool CheckPseudoHasCacheScope::Context::
     HasSiblingsWithAllDescendantsOrNextSiblingsChecked(Element* element) const {
   for (Element* sibling = ElementTraversal::PreviousSibling(*element); sibling;
@@ -16,6 +16,7 @@ namespace blink {
 class CSSSelector;
 class Document;
 class CheckPseudoHasArgumentContext;
+class CheckPseudoHasPersistentCache;
 
 // To determine whether a :has() pseudo class matches an element or not, we need
 // to check the :has() argument selector on the descendants, next siblings or
@@ -126,6 +127,10 @@ constexpr CheckPseudoHasResult
     kCheckPseudoHasResultAllDescendantsOrNextSiblingsChecked = 1 << 2;
 constexpr CheckPseudoHasResult kCheckPseudoHasResultSomeChildrenChecked = 1
                                                                           << 3;
+// Only set when the results are persisted across cache scopes. Indicates that
+// the element was checked as a :has() anchor element in the scope.
+// (Please refer the comments of CheckPseudoHasPersistentCache)
+constexpr CheckPseudoHasResult kCheckPseudoHasResultAnchorChecked = 1 << 4;
 
 // The :has() result cache keeps the :has() pseudo class checking result
 // regardless of the :has() pseudo class location (whether it is for subject or
@@ -221,11 +226,18 @@ using CheckPseudoHasFastRejectFilterCache =
 //
 // The cached results are valid until the DOM doesn't mutate, so any DOM
 // mutations inside the cache scope is not allowed for the consistency.
+//
+// If a CheckPseudoHasPersistentCache is passed to the first allocated
+// instance, the results which are not cached in the scope are looked up in
+// the persistent cache, and the results of the scope are merged into the
+// persistent cache at the destruction of the instance.
 class CORE_EXPORT CheckPseudoHasCacheScope {
   STACK_ALLOCATED();
 
  public:
-  explicit CheckPseudoHasCacheScope(Document*);
+  explicit CheckPseudoHasCacheScope(
+      Document*,
+      CheckPseudoHasPersistentCache* persistent_cache = nullptr);
   ~CheckPseudoHasCacheScope();
 
   // Context provides getter and setter of the following cache items.
@@ -264,6 +276,8 @@ class CORE_EXPORT CheckPseudoHasCacheScope {
     void SetTraversedElementAsChecked(Element* traversed_element,
                                       Element* parent);
 
+    CheckPseudoHasResult GetPersistentResult(Element*) const;
+
     bool HasSiblingsWithAllDescendantsOrNextSiblingsChecked(Element*) const;
     bool HasAncestorsWithAllDescendantsOrNextSiblingsChecked(Element*) const;
 
@@ -279,13 +293,18 @@ class CORE_EXPORT CheckPseudoHasCacheScope {
 
     bool cache_allowed_;
     ElementCheckPseudoHasResultMap* result_map_;
+    const ElementCheckPseudoHasResultMap* persistent_result_map_ = nullptr;
+    bool persist_results_ = false;
     ElementCheckPseudoHasFastRejectFilterMap* fast_reject_filter_map_;
     const CheckPseudoHasArgumentContext& argument_context_;
   };
 
  private:
-  static ElementCheckPseudoHasResultMap& GetResultMap(const Document*,
-                                                      const CSSSelector*);
+  static ElementCheckPseudoHasResultMap& GetResultMap(
+      const Document*,
+      const CSSSelector*,
+      const ElementCheckPseudoHasResultMap*& persistent_result_map);
+  static bool PersistsResults(const Document*);
   static ElementCheckPseudoHasFastRejectFilterMap& GetFastRejectFilterMap(
       const Document*,
       CheckPseudoHasArgumentTraversalType);
@@ -300,6 +319,7 @@ class CORE_EXPORT CheckPseudoHasCacheScope {
   CheckPseudoHasFastRejectFilterCache fast_reject_filter_cache_;
 
   Document* document_;
+  CheckPseudoHasPersistentCache* persistent_cache_ = nullptr;
 };
 
 }  // namespace blink
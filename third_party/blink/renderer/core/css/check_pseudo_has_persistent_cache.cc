@@ -0,0 +1,60 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/check_pseudo_has_persistent_cache.h"
+
+#include "third_party/blink/renderer/core/dom/element.h"
+
+namespace blink {
+
+const ElementCheckPseudoHasResultMap*
+CheckPseudoHasPersistentCache::GetResultMap(const String& selector_text) const {
+  auto iterator = results_.find(selector_text);
+  return iterator == results_.end() ? nullptr : iterator->value.Get();
+}
+
+void CheckPseudoHasPersistentCache::Merge(
+    const CheckPseudoHasResultCache& scope_result_cache) {
+  for (const auto& scope_entry : scope_result_cache) {
+    ElementCheckPseudoHasResultMap* result_map = nullptr;
+    for (const auto& element_entry : *scope_entry.value) {
+      // Only the :has() anchor elements have their :has() argument checking
+      // scope marked with the affected-by-has flags, which is what the
+      // invalidation relies on. E.g. the ancestors of an anchor element are
+      // marked as matched when a descendant matches, but are not invalidated
+      // when the descendant is removed.
+      if (!(element_entry.value & kCheckPseudoHasResultAnchorChecked))
+        continue;
+      if (!result_map) {
+        auto entry = results_.insert(scope_entry.key, nullptr);
+        if (entry.is_new_entry) {
+          entry.stored_value->value =
+              MakeGarbageCollected<ElementCheckPseudoHasResultMap>();
+        }
+        result_map = entry.stored_value->value;
+      }
+      result_map->Set(element_entry.key,
+                      element_entry.value & (kCheckPseudoHasResultChecked |
+                                             kCheckPseudoHasResultMatched));
+    }
+  }
+}
+
+void CheckPseudoHasPersistentCache::Invalidate(const Element& element) {
+  for (auto& entry : results_)
+    entry.value->erase(&element);
+}
+
+wtf_size_t CheckPseudoHasPersistentCache::ResultCountForTesting() const {
+  wtf_size_t count = 0;
+  for (const auto& entry : results_)
+    count += entry.value->size();
+  return count;
+}
+
+void CheckPseudoHasPersistentCache::Trace(Visitor* visitor) const {
+  visitor->Trace(results_);
+}
+
+}  // namespace blink
@@ -0,0 +1,60 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CHECK_PSEUDO_HAS_PERSISTENT_CACHE_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CHECK_PSEUDO_HAS_PERSISTENT_CACHE_H_
+
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/css/check_pseudo_has_cache_scope.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+
+namespace blink {
+
+class Element;
+
+// Keeps the :has() checking results of a document across style recalcs.
+//
+// The CheckPseudoHasCacheScope of StyleEngine::RecalcStyle() reads the results
+// from this cache, and merges its own results into it when the scope ends.
+// Only the Checked and Matched flags of the :has() anchor elements are kept.
+// The AllDescendantsOrNextSiblingsChecked and SomeChildrenChecked flags
+// describe the state of a whole traversal, and are only valid within one
+// scope.
+//
+// The results are invalidated by StyleEngine through the :has() invalidation
+// machinery: every element visited while invalidating the ancestors or
+// siblings affected by a :has() state change is removed from the cache, for
+// all the argument selectors. Mutations which do not need any :has()
+// invalidation according to the RuleFeatureSet keep the cached results.
+// Removed elements are dropped from the cache since their results depend on
+// the tree they are inserted into.
+class CORE_EXPORT CheckPseudoHasPersistentCache final
+    : public GarbageCollected<CheckPseudoHasPersistentCache> {
+ public:
+  // Returns the persisted results for the :has() argument selector text, or
+  // nullptr if there are none.
+  const ElementCheckPseudoHasResultMap* GetResultMap(
+      const String& selector_text) const;
+
+  // Persists the Checked and Matched flags of the result cache of a
+  // CheckPseudoHasCacheScope.
+  void Merge(const CheckPseudoHasResultCache& scope_result_cache);
+
+  // Removes the results of the element for all the argument selectors.
+  void Invalidate(const Element&);
+
+  void Clear() { results_.clear(); }
+  bool IsEmpty() const { return results_.IsEmpty(); }
+
+  wtf_size_t ResultCountForTesting() const;
+
+  void Trace(Visitor*) const;
+
+ private:
+  CheckPseudoHasResultCache results_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CHECK_PSEUDO_HAS_PERSISTENT_CACHE_H_
@@ -0,0 +1,149 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/check_pseudo_has_persistent_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/css/properties/longhands.h"
+#include "third_party/blink/renderer/core/css/style_engine.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/style/computed_style.h"
+#include "third_party/blink/renderer/core/testing/page_test_base.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+
+namespace blink {
+
+class CheckPseudoHasPersistentCacheTest : public PageTestBase {
+ protected:
+  CheckPseudoHasPersistentCache* GetPersistentCache() {
+    return GetDocument()
+        .GetStyleEngine()
+        .GetCheckPseudoHasPersistentCacheForTesting();
+  }
+
+  CheckPseudoHasResult GetPersistentResult(const char* selector_text,
+                                           const char* id) {
+    const ElementCheckPseudoHasResultMap* result_map =
+        GetPersistentCache()->GetResultMap(selector_text);
+    if (!result_map)
+      return kCheckPseudoHasResultNotCached;
+    auto iterator = result_map->find(GetElementById(id));
+    return iterator == result_map->end() ? kCheckPseudoHasResultNotCached
+                                         : iterator->value;
+  }
+
+  Color GetColor(const char* id) {
+    return GetElementById(id)->GetComputedStyle()->VisitedDependentColor(
+        GetCSSPropertyColor());
+  }
+
+  ScopedCSSPseudoHasPersistentCacheForTest persistent_cache_{true};
+};
+
+TEST_F(CheckPseudoHasPersistentCacheTest, ResultsSurviveRecalc) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      .a:has(.b) { color: green }
+      .c { background-color: blue }
+    </style>
+    <div id=a1 class=a><div id=d1><div id=d11></div></div></div>
+    <div id=a2 class=a><div id=d2 class=b></div></div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  ASSERT_TRUE(GetPersistentCache());
+  EXPECT_EQ(Color::kBlack, GetColor("a1"));
+  EXPECT_EQ(Color::FromRGB(0, 128, 0), GetColor("a2"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked, GetPersistentResult(".b", "a1"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked | kCheckPseudoHasResultMatched,
+            GetPersistentResult(".b", "a2"));
+
+  // Restyling the anchor elements for a change which does not affect the
+  // :has() argument keeps the results.
+  GetElementById("a1")->setAttribute(html_names::kClassAttr, "a c");
+  GetElementById("a2")->setAttribute(html_names::kClassAttr, "a c");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(Color::kBlack, GetColor("a1"));
+  EXPECT_EQ(Color::FromRGB(0, 128, 0), GetColor("a2"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked, GetPersistentResult(".b", "a1"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked | kCheckPseudoHasResultMatched,
+            GetPersistentResult(".b", "a2"));
+}
+
+TEST_F(CheckPseudoHasPersistentCacheTest, InvalidatedByHasArgumentChange) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      .a:has(.b) { color: green }
+    </style>
+    <div id=a1 class=a><div id=d1><div id=d11></div></div></div>
+    <div id=a2 class=a><div id=d2 class=b></div></div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+  ASSERT_TRUE(GetPersistentCache());
+  EXPECT_EQ(kCheckPseudoHasResultChecked, GetPersistentResult(".b", "a1"));
+
+  // The class change of d11 invalidates its ancestors through the :has()
+  // invalidation, and drops their results from the cache.
+  GetElementById("d11")->setAttribute(html_names::kClassAttr, "b");
+  EXPECT_EQ(kCheckPseudoHasResultNotCached, GetPersistentResult(".b", "a1"));
+  EXPECT_EQ(kCheckPseudoHasResultNotCached, GetPersistentResult(".b", "d1"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked | kCheckPseudoHasResultMatched,
+            GetPersistentResult(".b", "a2"));
+
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(Color::FromRGB(0, 128, 0), GetColor("a1"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked | kCheckPseudoHasResultMatched,
+            GetPersistentResult(".b", "a1"));
+
+  // Removing the matching element invalidates the anchor element.
+  GetElementById("d2")->remove();
+  EXPECT_EQ(kCheckPseudoHasResultNotCached, GetPersistentResult(".b", "a2"));
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(Color::kBlack, GetColor("a2"));
+  EXPECT_EQ(kCheckPseudoHasResultChecked, GetPersistentResult(".b", "a2"));
+}
+
+TEST_F(CheckPseudoHasPersistentCacheTest, RemovedElements) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      .a:has(.b) { color: green }
+    </style>
+    <div id=container>
+      <div id=a1 class=a><div class=b></div></div>
+    </div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+  ASSERT_TRUE(GetPersistentCache());
+  EXPECT_FALSE(GetPersistentCache()->IsEmpty());
+
+  Element* a1 = GetElementById("a1");
+  a1->remove();
+  EXPECT_EQ(0u, GetPersistentCache()->ResultCountForTesting());
+
+  // Re-inserting the element evaluates :has() again.
+  GetElementById("container")->AppendChild(a1);
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(Color::FromRGB(0, 128, 0), GetColor("a1"));
+}
+
+TEST_F(CheckPseudoHasPersistentCacheTest, ClearedOnStyleSheetChange) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style id=sheet>
+      .a:has(.b) { color: green }
+    </style>
+    <div id=a1 class=a><div class=b></div></div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+  ASSERT_TRUE(GetPersistentCache());
+  EXPECT_FALSE(GetPersistentCache()->IsEmpty());
+
+  GetElementById("sheet")->remove();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_TRUE(GetPersistentCache()->IsEmpty());
+  EXPECT_EQ(Color::kBlack, GetColor("a1"));
+}
+
+}  // namespace blink
@@ -6,10 +6,12 @@
 #include "third_party/blink/renderer/core/css/container_query.h"
 #include "third_party/blink/renderer/core/css/css_container_values.h"
 #include "third_party/blink/renderer/core/css/resolver/match_result.h"
+#include "third_party/blink/renderer/core/css/style_engine.h"
 #include "third_party/blink/renderer/core/css/style_recalc_context.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/node_computed_style.h"
 #include "third_party/blink/renderer/core/style/computed_style.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 #include "third_party/blink/renderer/core/css/media_values_cached.h"
 
@@ -128,6 +130,20 @@ ContainerQueryEvaluator::Result ContainerQueryEvaluator::Eval(
   if (!media_query_evaluator_)
     return Result();
 
+  // Style queries depend on the computed style of the container, which is not
+  // part of the cache key.
+  bool cacheable =
+      result_cache_ && !container_query.Selector().SelectsStyleContainers();
+  if (cacheable) {
+    if (absl::optional<bool> cached_value =
+            result_cache_->Find(container_query, result_cache_key_)) {
+      Result result;
+      result.value = *cached_value;
+      result.unit_flags = 0;
+      return result;
+    }
+  }
+
   MediaQueryResultFlags result_flags;
   bool value =
       (media_query_evaluator_->Eval(*container_query.query_, &result_flags) ==
@@ -136,6 +152,11 @@ ContainerQueryEvaluator::Result ContainerQueryEvaluator::Eval(
   Result result;
   result.value = value;
   result.unit_flags = result_flags.unit_flags;
+
+  // Results which depended on units are not only a function of the container
+  // size, and can not be shared with other containers.
+  if (cacheable && !result.unit_flags)
+    result_cache_->Add(container_query, result_cache_key_, value);
   return result;
 }
 
@@ -226,6 +247,7 @@ ContainerQueryEvaluator::StyleContainerChanged() {
 
 void ContainerQueryEvaluator::Trace(Visitor* visitor) const {
   visitor->Trace(media_query_evaluator_);
+  visitor->Trace(result_cache_);
   visitor->Trace(results_);
 }
 
@@ -260,6 +282,17 @@ void ContainerQueryEvaluator::SetData(Document& document,
       document, container, width, height);
   media_query_evaluator_ =
       MakeGarbageCollected<MediaQueryEvaluator>(query_values);
+
+  if (RuntimeEnabledFeatures::CSSContainerQueryResultCacheEnabled()) {
+    result_cache_ =
+        &document.GetStyleEngine().EnsureContainerQueryResultCache();
+    result_cache_key_.width = width;
+    result_cache_key_.height = height;
+    result_cache_key_.writing_mode =
+        container.ComputedStyleRef().GetWritingMode();
+  } else {
+    result_cache_ = nullptr;
+  }
 }
 
 void ContainerQueryEvaluator::ClearResults(Change change,
@@ -6,6 +6,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CONTAINER_QUERY_EVALUATOR_H_
 
 #include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/css/container_query_result_cache.h"
 #include "third_party/blink/renderer/core/css/container_selector.h"
 #include "third_party/blink/renderer/core/css/media_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/media_query_exp.h"
@@ -118,6 +119,10 @@ class CORE_EXPORT ContainerQueryEvaluator final
                   MatchResult& match_result);
 
   Member<MediaQueryEvaluator> media_query_evaluator_;
+  // Shared with the other size containers of the document. Only set when
+  // CSSContainerQueryResultCache is enabled.
+  Member<ContainerQueryResultCache> result_cache_;
+  ContainerQueryResultCache::SizeKey result_cache_key_;
   PhysicalSize size_;
   PhysicalAxes contained_axes_;
   HeapHashMap<Member<const ContainerQuery>, Result> results_;
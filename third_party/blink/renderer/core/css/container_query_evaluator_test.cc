@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/core/css/container_query_evaluator.h"
 
 #include "third_party/blink/renderer/core/css/container_query.h"
+#include "third_party/blink/renderer/core/css/container_query_result_cache.h"
 #include "third_party/blink/renderer/core/css/css_container_rule.h"
 #include "third_party/blink/renderer/core/css/css_custom_property_declaration.h"
 #include "third_party/blink/renderer/core/css/css_test_helpers.h"
@@ -713,6 +714,91 @@ TEST_F(ContainerQueryEvaluatorTest, CustomPropertyStyleQuery) {
   EXPECT_TRUE(Eval("style(--my-prop: 10px )", "--my-prop", "10px"));
 }
 
+TEST_F(ContainerQueryEvaluatorTest, SharedResultCache) {
+  ScopedCSSContainerQueryResultCacheForTest result_cache(true);
+
+  PhysicalSize size_100(LayoutUnit(100), LayoutUnit(100));
+  PhysicalSize size_200(LayoutUnit(200), LayoutUnit(200));
+
+  ContainerQuery* container_query_px = ParseContainer("(min-width: 150px)");
+  ContainerQuery* container_query_em = ParseContainer("(min-width: 10em)");
+  ContainerQuery* container_query_style = ParseContainer("style(--foo: bar)");
+  ASSERT_TRUE(container_query_px);
+  ASSERT_TRUE(container_query_em);
+  ASSERT_TRUE(container_query_style);
+
+  ContainerQueryResultCache& cache =
+      GetDocument().GetStyleEngine().EnsureContainerQueryResultCache();
+  cache.Clear();
+  unsigned hits = cache.HitCountForTesting();
+
+  auto* evaluator1 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  SizeContainerChanged(evaluator1, size_100, type_size, horizontal);
+  EXPECT_FALSE(EvalAndAdd(evaluator1, *container_query_px));
+  EXPECT_FALSE(EvalAndAdd(evaluator1, *container_query_em));
+  EXPECT_FALSE(EvalAndAdd(evaluator1, *container_query_style));
+  EXPECT_EQ(hits, cache.HitCountForTesting());
+
+  // Only the unit-less size query is shared.
+  EXPECT_EQ(1u, cache.QueryCountForTesting());
+
+  // A sibling container with the same size re-uses the result.
+  auto* evaluator2 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  SizeContainerChanged(evaluator2, size_100, type_size, horizontal);
+  EXPECT_FALSE(EvalAndAdd(evaluator2, *container_query_px));
+  EXPECT_EQ(hits + 1, cache.HitCountForTesting());
+
+  // A different size is evaluated, and ends up in the cache as well.
+  auto* evaluator3 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  SizeContainerChanged(evaluator3, size_200, type_size, horizontal);
+  EXPECT_TRUE(EvalAndAdd(evaluator3, *container_query_px));
+  EXPECT_EQ(hits + 1, cache.HitCountForTesting());
+
+  // Resizing the first container to 200px uses the result from the third.
+  EXPECT_EQ(Change::kNearestContainer,
+            SizeContainerChanged(evaluator1, size_200, type_size, horizontal));
+  EXPECT_EQ(hits + 2, cache.HitCountForTesting());
+  EXPECT_TRUE(EvalAndAdd(evaluator1, *container_query_px));
+  EXPECT_EQ(hits + 3, cache.HitCountForTesting());
+
+  // The contained axes are part of the key. The same size with only the
+  // vertical axis contained has no width, so the query is evaluated again.
+  auto* evaluator4 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  SizeContainerChanged(evaluator4, size_200, type_size, vertical);
+  EXPECT_FALSE(EvalAndAdd(evaluator4, *container_query_px));
+  EXPECT_EQ(hits + 3, cache.HitCountForTesting());
+
+  // The writing mode is part of the key as well.
+  scoped_refptr<ComputedStyle> vertical_style =
+      GetDocument().GetStyleResolver().InitialStyleForElement();
+  vertical_style->SetContainerType(type_size);
+  vertical_style->SetWritingMode(WritingMode::kVerticalRl);
+  ContainerElement().SetComputedStyle(vertical_style);
+  auto* evaluator5 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  evaluator5->SizeContainerChanged(GetDocument(), ContainerElement(), size_200,
+                                   horizontal);
+  EXPECT_TRUE(EvalAndAdd(evaluator5, *container_query_px));
+  EXPECT_EQ(hits + 3, cache.HitCountForTesting());
+
+  // The sizes are unzoomed, and the cached queries have no font-relative
+  // units, so a container which only differs in zoom uses the cached result.
+  scoped_refptr<ComputedStyle> zoomed_style =
+      GetDocument().GetStyleResolver().InitialStyleForElement();
+  zoomed_style->SetContainerType(type_size);
+  zoomed_style->SetEffectiveZoom(2);
+  ContainerElement().SetComputedStyle(zoomed_style);
+  auto* evaluator6 = MakeGarbageCollected<ContainerQueryEvaluator>();
+  evaluator6->SizeContainerChanged(GetDocument(), ContainerElement(), size_200,
+                                   horizontal);
+  EXPECT_TRUE(EvalAndAdd(evaluator6, *container_query_px));
+  EXPECT_EQ(hits + 4, cache.HitCountForTesting());
+  EXPECT_TRUE(EvalAndAdd(evaluator6, *container_query_em));
+  EXPECT_EQ(hits + 4, cache.HitCountForTesting());
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.QueryCountForTesting());
+}
+
 TEST_F(ContainerQueryEvaluatorTest, FindContainer) {
   SetBodyInnerHTML(R"HTML(
     <div style="container-name:outer;container-type:size">
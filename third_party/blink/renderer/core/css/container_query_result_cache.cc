@@ -0,0 +1,45 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/container_query_result_cache.h"
+
+#include "base/containers/contains.h"
+#include "third_party/blink/renderer/core/css/container_query.h"
+
+namespace blink {
+
+absl::optional<bool> ContainerQueryResultCache::Find(
+    const ContainerQuery& query,
+    const SizeKey& key) const {
+  auto it = results_.find(&query);
+  if (it == results_.end())
+    return absl::nullopt;
+  for (const QueryResults::Entry& entry : it->value->entries) {
+    if (entry.key == key) {
+      ++hit_count_;
+      return entry.value;
+    }
+  }
+  return absl::nullopt;
+}
+
+void ContainerQueryResultCache::Add(const ContainerQuery& query,
+                                    const SizeKey& key,
+                                    bool value) {
+  auto add_result = results_.insert(&query, nullptr);
+  if (add_result.is_new_entry)
+    add_result.stored_value->value = MakeGarbageCollected<QueryResults>();
+  Vector<QueryResults::Entry>& entries =
+      add_result.stored_value->value->entries;
+  DCHECK(!base::Contains(entries, key, &QueryResults::Entry::key));
+  if (entries.size() == kMaxSizesPerQuery)
+    entries.EraseAt(0);
+  entries.push_back(QueryResults::Entry{key, value});
+}
+
+void ContainerQueryResultCache::Trace(Visitor* visitor) const {
+  visitor->Trace(results_);
+}
+
+}  // namespace blink
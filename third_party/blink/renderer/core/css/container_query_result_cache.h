@@ -0,0 +1,81 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CONTAINER_QUERY_RESULT_CACHE_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CONTAINER_QUERY_RESULT_CACHE_H_
+
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/member.h"
+#include "third_party/blink/renderer/platform/text/writing_mode.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class ContainerQuery;
+
+// Document-level memo of container query results which only depend on the
+// size of the container, shared between all ContainerQueryEvaluators of the
+// document. Component-heavy pages typically have many sibling containers
+// with the same size evaluating the same ContainerQuery objects, and this
+// allows evaluating each of them once per distinct container size.
+//
+// ContainerQueryEvaluator only stores results here which did not use any
+// font-relative, root-font-relative, viewport-relative or container-relative
+// units, and which do not query style containers. Those results are a pure
+// function of the SizeKey. The cache is still cleared when fonts or the
+// active stylesheets change, to release the ContainerQuery references.
+class CORE_EXPORT ContainerQueryResultCache final
+    : public GarbageCollected<ContainerQueryResultCache> {
+ public:
+  struct SizeKey {
+    DISALLOW_NEW();
+
+    // The width/height are only set for the axes supported by the container.
+    absl::optional<double> width;
+    absl::optional<double> height;
+    // Affects the evaluation of logical features like inline-size.
+    WritingMode writing_mode = WritingMode::kHorizontalTb;
+
+    bool operator==(const SizeKey& o) const {
+      return width == o.width && height == o.height &&
+             writing_mode == o.writing_mode;
+    }
+    bool operator!=(const SizeKey& o) const { return !(*this == o); }
+  };
+
+  // The number of distinct container sizes cached per query. When a container
+  // is continuously resized, the oldest sizes are evicted first.
+  static constexpr wtf_size_t kMaxSizesPerQuery = 16;
+
+  absl::optional<bool> Find(const ContainerQuery&, const SizeKey&) const;
+  void Add(const ContainerQuery&, const SizeKey&, bool value);
+  void Clear() { results_.clear(); }
+
+  wtf_size_t QueryCountForTesting() const { return results_.size(); }
+  unsigned HitCountForTesting() const { return hit_count_; }
+
+  void Trace(Visitor*) const;
+
+ private:
+  class QueryResults final : public GarbageCollected<QueryResults> {
+   public:
+    struct Entry {
+      SizeKey key;
+      bool value;
+    };
+    Vector<Entry> entries;
+
+    void Trace(Visitor*) const {}
+  };
+
+  HeapHashMap<Member<const ContainerQuery>, Member<QueryResults>> results_;
+  mutable unsigned hit_count_ = 0;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_CONTAINER_QUERY_RESULT_CACHE_H_
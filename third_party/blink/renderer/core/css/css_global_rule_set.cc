@@ -47,6 +47,10 @@ void CSSGlobalRuleSet::Update(Document& document) {
     features_.Add(watched_selectors_rule_set_->Features());
 
   document.GetStyleEngine().CollectFeaturesTo(features_);
+
+  // Documents with the same style sheets combine the invalidation sets for
+  // the same features into equal sets.
+  features_.InternInvalidationSets();
 }
 
 void CSSGlobalRuleSet::Dispose() {
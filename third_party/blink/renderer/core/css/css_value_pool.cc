@@ -62,6 +62,33 @@ CSSValuePool::CSSValuePool()
   number_value_cache_.resize(kMaximumCacheableIntegerValue + 1);
 }
 
+CSSValuePool::CSSColor* CSSValuePool::CreateRecentColor(const Color& color) {
+  DCHECK(!color_value_cache_.Contains(color));
+  if (color_value_cache_.size() >= kMaximumColorCacheSize / 2) {
+    color_value_cache_.swap(previous_color_value_cache_);
+    color_value_cache_.clear();
+  }
+  CSSColor* value = previous_color_value_cache_.Take(color);
+  if (!value)
+    value = MakeGarbageCollected<CSSColor>(color);
+  color_value_cache_.insert(color, value);
+  return value;
+}
+
+CSSValuePool::FontFaceValueCache::AddResult
+CSSValuePool::GetFontFaceCacheEntry(const AtomicString& string) {
+  if (font_face_value_cache_.size() >= kMaximumFontFaceCacheSize / 2 &&
+      !font_face_value_cache_.Contains(string)) {
+    font_face_value_cache_.swap(previous_font_face_value_cache_);
+    font_face_value_cache_.clear();
+  }
+  FontFaceValueCache::AddResult entry =
+      font_face_value_cache_.insert(string, nullptr);
+  if (entry.is_new_entry)
+    entry.stored_value->value = previous_font_face_value_cache_.Take(string);
+  return entry;
+}
+
 void CSSValuePool::Trace(Visitor* visitor) const {
   visitor->Trace(inherited_value_);
   visitor->Trace(initial_value_);
@@ -79,7 +106,9 @@ void CSSValuePool::Trace(Visitor* visitor) const {
   visitor->Trace(percent_value_cache_);
   visitor->Trace(number_value_cache_);
   visitor->Trace(color_value_cache_);
+  visitor->Trace(previous_color_value_cache_);
   visitor->Trace(font_face_value_cache_);
+  visitor->Trace(previous_font_face_value_cache_);
   visitor->Trace(font_family_value_cache_);
 }
 
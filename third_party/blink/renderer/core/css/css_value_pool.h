@@ -79,6 +79,11 @@ class CORE_EXPORT CSSValuePool final : public GarbageCollected<CSSValuePool> {
                                       Member<CSSColor>,
                                       typename DefaultHash<Color>::Hash,
                                       ColorHashTraitsForCSSValuePool>;
+  // The color and font face caches keep their entries in two generations of
+  // at most half of the maximum size each. When the current generation is
+  // full, it becomes the previous generation, and the entries of the previous
+  // generation which are used again are moved to the new current generation.
+  // This evicts the least recently used entries instead of the whole cache.
   static const unsigned kMaximumColorCacheSize = 512;
   using FontFaceValueCache =
       HeapHashMap<AtomicString, Member<const CSSValueList>>;
@@ -152,26 +157,20 @@ class CORE_EXPORT CSSValuePool final : public GarbageCollected<CSSValuePool> {
     if (color == Color::kBlack)
       return BlackColor();
 
-    // Just wipe out the cache and start rebuilding if it gets too big.
-    if (color_value_cache_.size() > kMaximumColorCacheSize)
-      color_value_cache_.clear();
-
-    ColorValueCache::AddResult entry =
-        color_value_cache_.insert(color, nullptr);
-    if (entry.is_new_entry)
-      entry.stored_value->value = MakeGarbageCollected<CSSColor>(color);
-    return entry.stored_value->value;
+    auto recent = color_value_cache_.find(color);
+    if (recent != color_value_cache_.end())
+      return recent->value;
+    return CreateRecentColor(color);
   }
   FontFamilyValueCache::AddResult GetFontFamilyCacheEntry(
       const String& family_name) {
     return font_family_value_cache_.insert(family_name, nullptr);
   }
   FontFaceValueCache::AddResult GetFontFaceCacheEntry(
-      const AtomicString& string) {
-    // Just wipe out the cache and start rebuilding if it gets too big.
-    if (font_face_value_cache_.size() > kMaximumFontFaceCacheSize)
-      font_face_value_cache_.clear();
-    return font_face_value_cache_.insert(string, nullptr);
+      const AtomicString& string);
+
+  wtf_size_t ColorCacheSizeForTesting() const {
+    return color_value_cache_.size() + previous_color_value_cache_.size();
   }
 
   void Trace(Visitor*) const;
@@ -200,9 +199,13 @@ class CORE_EXPORT CSSValuePool final : public GarbageCollected<CSSValuePool> {
   HeapVector<Member<CSSNumericLiteralValue>, kMaximumCacheableIntegerValue + 1>
       number_value_cache_;
 
+  CSSColor* CreateRecentColor(const Color&);
+
   // Hash map caches.
   ColorValueCache color_value_cache_;
+  ColorValueCache previous_color_value_cache_;
   FontFaceValueCache font_face_value_cache_;
+  FontFaceValueCache previous_font_face_value_cache_;
   FontFamilyValueCache font_family_value_cache_;
 
   friend CORE_EXPORT CSSValuePool& CssValuePool();
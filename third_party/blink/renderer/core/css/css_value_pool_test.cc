@@ -0,0 +1,57 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/css_value_pool.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+
+namespace blink {
+
+namespace {
+
+Color ColorForIndex(unsigned index) {
+  // Avoids transparent, white and black, which have dedicated values.
+  return Color::FromRGBA(index & 0xff, (index >> 8) & 0xff, 1, 2);
+}
+
+}  // namespace
+
+TEST(CSSValuePoolTest, ColorCacheEvictsLeastRecentlyUsed) {
+  Persistent<CSSValuePool> pool = MakeGarbageCollected<CSSValuePool>();
+  const Color hot_color = ColorForIndex(0xffff);
+  Persistent<cssvalue::CSSColor> hot_value = pool->GetOrCreateColor(hot_color);
+  Persistent<cssvalue::CSSColor> cold_value =
+      pool->GetOrCreateColor(ColorForIndex(0));
+
+  // Using many different colors does not evict the color which is used in
+  // between, unlike the cold color.
+  for (unsigned i = 1; i <= CSSValuePool::kMaximumColorCacheSize * 2; ++i) {
+    pool->GetOrCreateColor(ColorForIndex(i));
+    EXPECT_EQ(hot_value.Get(), pool->GetOrCreateColor(hot_color));
+    EXPECT_GE(CSSValuePool::kMaximumColorCacheSize,
+              pool->ColorCacheSizeForTesting());
+  }
+  EXPECT_NE(cold_value.Get(), pool->GetOrCreateColor(ColorForIndex(0)));
+}
+
+TEST(CSSValuePoolTest, FontFaceCacheKeepsRecentEntries) {
+  Persistent<CSSValuePool> pool = MakeGarbageCollected<CSSValuePool>();
+  const AtomicString hot_font("bold 12px hot");
+  Persistent<CSSValueList> hot_value = CSSValueList::CreateCommaSeparated();
+  pool->GetFontFaceCacheEntry(hot_font).stored_value->value = hot_value;
+
+  for (unsigned i = 0; i < CSSValuePool::kMaximumFontFaceCacheSize * 2; ++i) {
+    auto entry = pool->GetFontFaceCacheEntry(
+        AtomicString("12px font" + String::Number(i)));
+    EXPECT_TRUE(entry.is_new_entry);
+    EXPECT_FALSE(entry.stored_value->value);
+    entry.stored_value->value = CSSValueList::CreateCommaSeparated();
+
+    auto hot_entry = pool->GetFontFaceCacheEntry(hot_font);
+    EXPECT_EQ(hot_value.Get(), hot_entry.stored_value->value.Get());
+  }
+}
+
+}  // namespace blink
@@ -51,6 +51,7 @@
 #include "third_party/blink/renderer/core/css/resolver/style_rule_usage_tracker.h"
 #include "third_party/blink/renderer/core/css/selector_statistics.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
+#include "third_party/blink/renderer/core/dom/dom_node_ids.h"
 #include "third_party/blink/renderer/core/dom/layout_tree_builder_traversal.h"
 #include "third_party/blink/renderer/core/dom/node_computed_style.h"
 #include "third_party/blink/renderer/core/dom/shadow_root.h"
@@ -205,10 +206,9 @@ class CascadeLayerSeeker {
 // UpdateStyleAndLayoutTreeForThisDocument level, which yields the statistics
 // aggregated across each style recalc pass.
 struct CumulativeRulePerfData {
-  int match_attempts;
-  int fast_reject_count;
-  int match_count;
-  base::TimeDelta elapsed;
+  SelectorStatisticsReport::Counts counts;
+  SelectorStatisticsBucket bucket = SelectorStatisticsBucket::kUniversal;
+  String style_sheet_name;
 };
 
 using SelectorStatisticsRuleMap =
@@ -218,24 +218,43 @@ SelectorStatisticsRuleMap& GetSelectorStatisticsRuleMap() {
   return rule_map;
 }
 
+// Identifies the style sheet of a rule in the report, such that the same style
+// sheet has the same name in every pass. The UA rules are matched without a
+// style sheet.
+String StyleSheetNameForStatistics(const CSSStyleSheet* style_sheet) {
+  if (!style_sheet)
+    return "<no style sheet>";
+  String href = style_sheet->href();
+  if (!href.IsEmpty())
+    return href;
+  if (Node* owner_node = style_sheet->ownerNode()) {
+    return "<inline style sheet of node " +
+           String::Number(DOMNodeIds::IdForNode(owner_node)) + ">";
+  }
+  return "<constructed style sheet>";
+}
+
 void AggregateRulePerfData(
-    const HeapVector<RulePerfDataPerRequest>& rules_statistics) {
+    const HeapVector<RulePerfDataPerRequest>& rules_statistics,
+    SelectorStatisticsBucket bucket,
+    const CSSStyleSheet* style_sheet) {
   SelectorStatisticsRuleMap& map = GetSelectorStatisticsRuleMap();
   for (const auto& rule_stats : rules_statistics) {
-    auto it = map.find(rule_stats.rule);
-    if (it == map.end()) {
-      CumulativeRulePerfData data{
-          /*match_attempts*/ 1, (rule_stats.fast_reject) ? 1 : 0,
-          (rule_stats.did_match) ? 1 : 0, rule_stats.elapsed};
-      map.insert(rule_stats.rule, data);
-    } else {
-      it->value.elapsed += rule_stats.elapsed;
-      it->value.match_attempts++;
-      if (rule_stats.fast_reject)
-        it->value.fast_reject_count++;
-      if (rule_stats.did_match)
-        it->value.match_count++;
+    auto add_result = map.insert(rule_stats.rule, CumulativeRulePerfData());
+    CumulativeRulePerfData& data = add_result.stored_value->value;
+    if (add_result.is_new_entry) {
+      // The style sheet may be gone when the map is dumped, so resolve its
+      // name while the rule is matched.
+      data.bucket = bucket;
+      data.style_sheet_name = StyleSheetNameForStatistics(style_sheet);
     }
+    SelectorStatisticsReport::Counts& counts = data.counts;
+    counts.elapsed += rule_stats.elapsed;
+    counts.match_attempts++;
+    if (rule_stats.fast_reject)
+      counts.fast_reject_count++;
+    if (rule_stats.did_match)
+      counts.match_count++;
   }
 }
 
@@ -247,6 +266,14 @@ void AggregateRulePerfData(
 // `TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED` for more details.
 static const unsigned char* g_selector_stats_tracing_enabled = nullptr;
 
+// Points `g_selector_stats_tracing_enabled` at this value instead of the
+// tracing state while `g_selector_stats_report_for_testing` is set.
+static const unsigned char g_selector_stats_enabled_for_testing = 1;
+
+// The report which `DumpAndClearRulesPerfMap` adds each pass to, if any. See
+// `SetSelectorStatisticsReportForTesting`.
+static SelectorStatisticsReport* g_selector_stats_report_for_testing = nullptr;
+
 }  // namespace
 
 ElementRuleCollector::ElementRuleCollector(
@@ -334,6 +361,7 @@ static bool RulesApplicableInCurrentTreeScope(
 template <bool perf_trace_enabled>
 void ElementRuleCollector::CollectMatchingRulesForListInternal(
     base::span<const RuleData> rules,
+    SelectorStatisticsBucket bucket,
     const MatchRequest& match_request,
     const RuleSet* rule_set,
     const CSSStyleSheet* style_sheet,
@@ -442,7 +470,8 @@ void ElementRuleCollector::CollectMatchingRulesForListInternal(
 
   if (perf_trace_enabled) {
     selector_statistics_collector.EndCollectionForCurrentRule();
-    AggregateRulePerfData(selector_statistics_collector.PerRuleStatistics());
+    AggregateRulePerfData(selector_statistics_collector.PerRuleStatistics(),
+                          bucket, style_sheet);
   }
 
   StyleEngine& style_engine =
@@ -459,6 +488,7 @@ void ElementRuleCollector::CollectMatchingRulesForListInternal(
 
 void ElementRuleCollector::CollectMatchingRulesForList(
     base::span<const RuleData> rules,
+    SelectorStatisticsBucket bucket,
     const MatchRequest& match_request,
     const RuleSet* rule_set,
     const CSSStyleSheet* style_sheet,
@@ -476,13 +506,13 @@ void ElementRuleCollector::CollectMatchingRulesForList(
   // parameter to eliminate branching in CollectMatchingRulesForListInternal
   // when tracing is not enabled.
   if (!*g_selector_stats_tracing_enabled) {
-    CollectMatchingRulesForListInternal<false>(rules, match_request, rule_set,
-                                               style_sheet, style_sheet_index,
-                                               checker, part_request);
+    CollectMatchingRulesForListInternal<false>(
+        rules, bucket, match_request, rule_set, style_sheet,
+        style_sheet_index, checker, part_request);
   } else {
-    CollectMatchingRulesForListInternal<true>(rules, match_request, rule_set,
-                                              style_sheet, style_sheet_index,
-                                              checker, part_request);
+    CollectMatchingRulesForListInternal<true>(
+        rules, bucket, match_request, rule_set, style_sheet, style_sheet_index,
+        checker, part_request);
   }
 }
 
@@ -516,7 +546,8 @@ void ElementRuleCollector::CollectMatchingRules(
     DCHECK(element.IsStyledElement());
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
-          bundle.rule_set->UAShadowPseudoElementRules(pseudo_id), match_request,
+          bundle.rule_set->UAShadowPseudoElementRules(pseudo_id),
+          SelectorStatisticsBucket::kUAShadowPseudo, match_request,
           bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
           checker);
     }
@@ -525,8 +556,9 @@ void ElementRuleCollector::CollectMatchingRules(
   if (element.IsVTTElement()) {
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
-          bundle.rule_set->CuePseudoRules(), match_request, bundle.rule_set,
-          bundle.style_sheet, bundle.style_sheet_index, checker);
+          bundle.rule_set->CuePseudoRules(), SelectorStatisticsBucket::kCue,
+          match_request, bundle.rule_set, bundle.style_sheet,
+          bundle.style_sheet_index, checker);
     }
   }
   // Check whether other types of rules are applicable in the current tree
@@ -545,17 +577,17 @@ void ElementRuleCollector::CollectMatchingRules(
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
           bundle.rule_set->IdRules(element.IdForStyleResolution()),
-          match_request, bundle.rule_set, bundle.style_sheet,
-          bundle.style_sheet_index, checker);
+          SelectorStatisticsBucket::kId, match_request, bundle.rule_set,
+          bundle.style_sheet, bundle.style_sheet_index, checker);
     }
   }
   if (element.IsStyledElement() && element.HasClass()) {
     for (wtf_size_t i = 0; i < element.ClassNames().size(); ++i) {
       for (const auto bundle : match_request.AllRuleSets()) {
         CollectMatchingRulesForList(
-            bundle.rule_set->ClassRules(element.ClassNames()[i]), match_request,
-            bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
-            checker);
+            bundle.rule_set->ClassRules(element.ClassNames()[i]),
+            SelectorStatisticsBucket::kClass, match_request, bundle.rule_set,
+            bundle.style_sheet, bundle.style_sheet_index, checker);
       }
     }
   }
@@ -623,10 +655,11 @@ void ElementRuleCollector::CollectMatchingRules(
           if (!list.empty() &&
               !bundle.rule_set->CanIgnoreEntireList(
                   list, lower_name, attributes[attr_idx].Value())) {
-            CollectMatchingRulesForList(bundle.rule_set->AttrRules(lower_name),
-                                        match_request, bundle.rule_set,
-                                        bundle.style_sheet,
-                                        bundle.style_sheet_index, checker);
+            CollectMatchingRulesForList(
+                bundle.rule_set->AttrRules(lower_name),
+                SelectorStatisticsBucket::kAttr, match_request,
+                bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
+                checker);
           }
         }
       }
@@ -638,10 +671,11 @@ void ElementRuleCollector::CollectMatchingRules(
 
   if (element.IsLink()) {
     for (const auto bundle : match_request.AllRuleSets()) {
-      CollectMatchingRulesForList(bundle.rule_set->LinkPseudoClassRules(),
-                                  match_request, bundle.rule_set,
-                                  bundle.style_sheet, bundle.style_sheet_index,
-                                  checker);
+      CollectMatchingRulesForList(
+          bundle.rule_set->LinkPseudoClassRules(),
+          SelectorStatisticsBucket::kLinkPseudoClass, match_request,
+          bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
+          checker);
     }
   }
   if (inside_link_ != EInsideLink::kNotInsideLink) {
@@ -651,24 +685,27 @@ void ElementRuleCollector::CollectMatchingRules(
     // a transition rule, we create a transition even if it has no visible
     // effect.
     for (const auto bundle : match_request.AllRuleSets()) {
-      CollectMatchingRulesForList(bundle.rule_set->VisitedDependentRules(),
-                                  match_request, bundle.rule_set,
-                                  bundle.style_sheet, bundle.style_sheet_index,
-                                  checker);
+      CollectMatchingRulesForList(
+          bundle.rule_set->VisitedDependentRules(),
+          SelectorStatisticsBucket::kVisitedDependent, match_request,
+          bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
+          checker);
     }
   }
   if (SelectorChecker::MatchesFocusPseudoClass(element)) {
     for (const auto bundle : match_request.AllRuleSets()) {
-      CollectMatchingRulesForList(bundle.rule_set->FocusPseudoClassRules(),
-                                  match_request, bundle.rule_set,
-                                  bundle.style_sheet, bundle.style_sheet_index,
-                                  checker);
+      CollectMatchingRulesForList(
+          bundle.rule_set->FocusPseudoClassRules(),
+          SelectorStatisticsBucket::kFocusPseudoClass, match_request,
+          bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
+          checker);
     }
   }
   if (SelectorChecker::MatchesSelectorFragmentAnchorPseudoClass(element)) {
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
-          bundle.rule_set->SelectorFragmentAnchorRules(), match_request,
+          bundle.rule_set->SelectorFragmentAnchorRules(),
+          SelectorStatisticsBucket::kSelectorFragmentAnchor, match_request,
           bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
           checker);
     }
@@ -676,7 +713,8 @@ void ElementRuleCollector::CollectMatchingRules(
   if (SelectorChecker::MatchesFocusVisiblePseudoClass(element)) {
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
-          bundle.rule_set->FocusVisiblePseudoClassRules(), match_request,
+          bundle.rule_set->FocusVisiblePseudoClassRules(),
+          SelectorStatisticsBucket::kFocusVisiblePseudoClass, match_request,
           bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index,
           checker);
     }
@@ -685,6 +723,7 @@ void ElementRuleCollector::CollectMatchingRules(
     for (const auto bundle : match_request.AllRuleSets()) {
       CollectMatchingRulesForList(
           bundle.rule_set->SpatialNavigationInterestPseudoClassRules(),
+          SelectorStatisticsBucket::kSpatialNavigationInterestPseudoClass,
           match_request, bundle.rule_set, bundle.style_sheet,
           bundle.style_sheet_index, checker);
     }
@@ -694,12 +733,14 @@ void ElementRuleCollector::CollectMatchingRules(
                                   : element.LocalNameForSelectorMatching();
   for (const auto bundle : match_request.AllRuleSets()) {
     CollectMatchingRulesForList(
-        bundle.rule_set->TagRules(element_name), match_request, bundle.rule_set,
-        bundle.style_sheet, bundle.style_sheet_index, checker);
+        bundle.rule_set->TagRules(element_name), SelectorStatisticsBucket::kTag,
+        match_request, bundle.rule_set, bundle.style_sheet,
+        bundle.style_sheet_index, checker);
   }
   for (const auto bundle : match_request.AllRuleSets()) {
     CollectMatchingRulesForList(
-        bundle.rule_set->UniversalRules(), match_request, bundle.rule_set,
+        bundle.rule_set->UniversalRules(),
+        SelectorStatisticsBucket::kUniversal, match_request, bundle.rule_set,
         bundle.style_sheet, bundle.style_sheet_index, checker);
   }
 }
@@ -711,7 +752,8 @@ void ElementRuleCollector::CollectMatchingShadowHostRules(
 
   for (const auto bundle : match_request.AllRuleSets()) {
     CollectMatchingRulesForList(
-        bundle.rule_set->ShadowHostRules(), match_request, bundle.rule_set,
+        bundle.rule_set->ShadowHostRules(),
+        SelectorStatisticsBucket::kShadowHost, match_request, bundle.rule_set,
         bundle.style_sheet, bundle.style_sheet_index, checker);
   }
 }
@@ -723,8 +765,9 @@ void ElementRuleCollector::CollectMatchingSlottedRules(
 
   for (const auto bundle : match_request.AllRuleSets()) {
     CollectMatchingRulesForList(
-        bundle.rule_set->SlottedPseudoElementRules(), match_request,
-        bundle.rule_set, bundle.style_sheet, bundle.style_sheet_index, checker);
+        bundle.rule_set->SlottedPseudoElementRules(),
+        SelectorStatisticsBucket::kSlotted, match_request, bundle.rule_set,
+        bundle.style_sheet, bundle.style_sheet_index, checker);
   }
 }
 
@@ -738,8 +781,9 @@ void ElementRuleCollector::CollectMatchingPartPseudoRules(
 
   for (const auto bundle : match_request.AllRuleSets()) {
     CollectMatchingRulesForList(
-        bundle.rule_set->PartPseudoRules(), match_request, bundle.rule_set,
-        bundle.style_sheet, bundle.style_sheet_index, checker, &request);
+        bundle.rule_set->PartPseudoRules(), SelectorStatisticsBucket::kPart,
+        match_request, bundle.rule_set, bundle.style_sheet,
+        bundle.style_sheet_index, checker, &request);
   }
 }
 
@@ -899,26 +943,47 @@ void ElementRuleCollector::DidMatchRule(
 }
 
 void ElementRuleCollector::DumpAndClearRulesPerfMap() {
+  SelectorStatisticsRuleMap& rule_map = GetSelectorStatisticsRuleMap();
+  if (g_selector_stats_report_for_testing) {
+    for (const auto& it : rule_map) {
+      g_selector_stats_report_for_testing->Add(
+          it.key->Selector().SelectorText(), it.value.style_sheet_name,
+          it.value.bucket, it.value.counts);
+    }
+  }
   TRACE_EVENT1(
       TRACE_DISABLED_BY_DEFAULT("blink.debug"), "SelectorStats",
       "selector_stats", [&](perfetto::TracedValue context) {
         perfetto::TracedDictionary dict = std::move(context).WriteDictionary();
         {
           perfetto::TracedArray array = dict.AddArray("selector_timings");
-          for (auto& it : GetSelectorStatisticsRuleMap()) {
+          for (auto& it : rule_map) {
             perfetto::TracedValue item = array.AppendItem();
             perfetto::TracedDictionary item_dict =
                 std::move(item).WriteDictionary();
             const CSSSelector& selector = it.key->Selector();
+            const SelectorStatisticsReport::Counts& counts = it.value.counts;
             item_dict.Add("selector", selector.SelectorText());
-            item_dict.Add("elapsed (us)", it.value.elapsed);
-            item_dict.Add("match_attempts", it.value.match_attempts);
-            item_dict.Add("fast_reject_count", it.value.fast_reject_count);
-            item_dict.Add("match_count", it.value.match_count);
+            item_dict.Add("style_sheet", it.value.style_sheet_name);
+            item_dict.Add("bucket",
+                          SelectorStatisticsBucketName(it.value.bucket));
+            item_dict.Add("elapsed (us)", counts.elapsed);
+            item_dict.Add("match_attempts", counts.match_attempts);
+            item_dict.Add("fast_reject_count", counts.fast_reject_count);
+            item_dict.Add("match_count", counts.match_count);
           }
         }
       });
-  GetSelectorStatisticsRuleMap().clear();
+  rule_map.clear();
+}
+
+void ElementRuleCollector::SetSelectorStatisticsReportForTesting(
+    SelectorStatisticsReport* report) {
+  g_selector_stats_report_for_testing = report;
+  // When unset, the next ElementRuleCollector picks up the tracing state
+  // again.
+  g_selector_stats_tracing_enabled =
+      report ? &g_selector_stats_enabled_for_testing : nullptr;
 }
 
 inline bool ElementRuleCollector::CompareRules(
@@ -32,6 +32,7 @@
 #include "third_party/blink/renderer/core/css/resolver/match_request.h"
 #include "third_party/blink/renderer/core/css/resolver/match_result.h"
 #include "third_party/blink/renderer/core/css/selector_checker.h"
+#include "third_party/blink/renderer/core/css/selector_statistics.h"
 #include "third_party/blink/renderer/core/css/style_recalc_context.h"
 #include "third_party/blink/renderer/core/css/style_request.h"
 #include "third_party/blink/renderer/core/style/computed_style_base_constants.h"
@@ -180,6 +181,13 @@ class CORE_EXPORT ElementRuleCollector {
   // aggregated per-rule for the entire style recalc pass.
   static void DumpAndClearRulesPerfMap();
 
+  // While |report| is set, collects the selector statistics regardless of the
+  // tracing state, and adds each pass dumped with DumpAndClearRulesPerfMap()
+  // to |report|, e.g. for reporting them from perf tests. The caller owns the
+  // report, and must unset it before the report goes away.
+  static void SetSelectorStatisticsReportForTesting(
+      SelectorStatisticsReport* report);
+
   // Temporarily swap the StyleRecalcContext with one which points to the
   // closest query container for matching ::slotted rules for a given slot.
   class SlottedRulesScope {
@@ -214,6 +222,7 @@ class CORE_EXPORT ElementRuleCollector {
 
   template <bool perf_trace_enabled>
   void CollectMatchingRulesForListInternal(base::span<const RuleData>,
+                                           SelectorStatisticsBucket,
                                            const MatchRequest&,
                                            const RuleSet*,
                                            const CSSStyleSheet*,
@@ -222,6 +231,7 @@ class CORE_EXPORT ElementRuleCollector {
                                            PartRequest* = nullptr);
 
   void CollectMatchingRulesForList(base::span<const RuleData>,
+                                   SelectorStatisticsBucket,
                                    const MatchRequest&,
                                    const RuleSet*,
                                    const CSSStyleSheet*,
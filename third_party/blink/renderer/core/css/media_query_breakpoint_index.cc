@@ -0,0 +1,200 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/media_query_breakpoint_index.h"
+
+#include <algorithm>
+
+#include "third_party/blink/renderer/core/css/media_feature_names.h"
+#include "third_party/blink/renderer/core/css/media_list.h"
+#include "third_party/blink/renderer/core/css/media_query.h"
+#include "third_party/blink/renderer/core/css/media_query_exp.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/wtf/math_extras.h"
+
+namespace blink {
+
+namespace {
+
+// Returns the px value of a compared length which does not depend on anything
+// but the viewport size itself, i.e. an absolute length, or a plain number
+// which MediaQueryEvaluator treats as px in quirks mode.
+bool AbsolutePixels(const MediaQueryExpValue& value, double& result) {
+  if (!value.IsNumeric())
+    return false;
+  if (value.Unit() == CSSPrimitiveValue::UnitType::kNumber) {
+    result = ClampTo<int>(value.Value());
+    return true;
+  }
+  if (!CSSPrimitiveValue::IsLength(value.Unit()) || value.GetUnitFlags())
+    return false;
+  result = value.Value() *
+           CSSPrimitiveValue::ConversionToCanonicalUnitsScaleFactor(
+               value.Unit());
+  return true;
+}
+
+bool IsWidthFeature(const String& feature) {
+  return feature == media_feature_names::kWidthMediaFeature ||
+         feature == media_feature_names::kMinWidthMediaFeature ||
+         feature == media_feature_names::kMaxWidthMediaFeature;
+}
+
+bool IsHeightFeature(const String& feature) {
+  return feature == media_feature_names::kHeightMediaFeature ||
+         feature == media_feature_names::kMinHeightMediaFeature ||
+         feature == media_feature_names::kMaxHeightMediaFeature;
+}
+
+bool IsAspectRatioFeature(const String& feature) {
+  return feature == media_feature_names::kAspectRatioMediaFeature ||
+         feature == media_feature_names::kMinAspectRatioMediaFeature ||
+         feature == media_feature_names::kMaxAspectRatioMediaFeature;
+}
+
+// The sign of the comparison MediaQueryEvaluator does for aspect-ratio, which
+// uses the integral viewport size.
+int AspectRatioSign(const gfx::SizeF& size,
+                    const std::pair<unsigned, unsigned>& ratio) {
+  double diff = static_cast<double>(static_cast<int>(size.width())) *
+                    ratio.second -
+                static_cast<double>(static_cast<int>(size.height())) *
+                    ratio.first;
+  return (diff > 0) - (diff < 0);
+}
+
+bool IsLandscape(const gfx::SizeF& size) {
+  return static_cast<int>(size.width()) > static_cast<int>(size.height());
+}
+
+}  // namespace
+
+void MediaQueryBreakpointIndex::Add(const MediaQuerySet& query_set,
+                                    wtf_size_t result_index) {
+  HeapVector<MediaQueryExp> expressions;
+  for (const auto& query : query_set.QueryVector()) {
+    if (const MediaQueryExpNode* exp_node = query->ExpNode())
+      exp_node->CollectExpressions(expressions);
+  }
+  for (const MediaQueryExp& exp : expressions) {
+    if (!exp.IsViewportDependent() && !exp.IsDeviceDependent())
+      continue;
+    if (!AddExpression(exp, result_index)) {
+      // Breakpoints already added for this set are harmless since the
+      // collected indices are de-duplicated.
+      unindexed_results_.push_back(result_index);
+      return;
+    }
+  }
+}
+
+bool MediaQueryBreakpointIndex::AddExpression(const MediaQueryExp& exp,
+                                              wtf_size_t result_index) {
+  const String& feature = exp.MediaFeature();
+  const MediaQueryExpBounds& bounds = exp.Bounds();
+
+  if (feature == media_feature_names::kOrientationMediaFeature) {
+    orientation_results_.push_back(result_index);
+    return true;
+  }
+
+  if (IsAspectRatioFeature(feature)) {
+    // ({,min-,max-}aspect-ratio) always evaluates to true.
+    for (const MediaQueryExpComparison* comparison :
+         {&bounds.left, &bounds.right}) {
+      if (!comparison->IsValid())
+        continue;
+      if (!comparison->value.IsRatio())
+        return false;
+      aspect_ratios_.push_back(std::make_pair(
+          comparison->value.Numerator(), comparison->value.Denominator()));
+      aspect_ratio_results_.push_back(result_index);
+    }
+    return true;
+  }
+
+  Vector<Breakpoint>* breakpoints = nullptr;
+  if (IsWidthFeature(feature))
+    breakpoints = &width_breakpoints_;
+  else if (IsHeightFeature(feature))
+    breakpoints = &height_breakpoints_;
+  else
+    return false;
+
+  if (!bounds.left.IsValid() && !bounds.right.IsValid()) {
+    // (width) and (height) evaluate to true for non-zero sizes.
+    InsertBreakpoint(*breakpoints, 0, result_index);
+    return true;
+  }
+  for (const MediaQueryExpComparison* comparison :
+       {&bounds.left, &bounds.right}) {
+    if (!comparison->IsValid())
+      continue;
+    double px;
+    if (!AbsolutePixels(comparison->value, px))
+      return false;
+    InsertBreakpoint(*breakpoints, px, result_index);
+  }
+  return true;
+}
+
+void MediaQueryBreakpointIndex::InsertBreakpoint(
+    Vector<Breakpoint>& breakpoints,
+    double value,
+    wtf_size_t result_index) {
+  auto* it = std::upper_bound(
+      breakpoints.begin(), breakpoints.end(), value,
+      [](double v, const Breakpoint& breakpoint) {
+        return v < breakpoint.value;
+      });
+  breakpoints.insert(static_cast<wtf_size_t>(it - breakpoints.begin()),
+                     Breakpoint{value, result_index});
+}
+
+void MediaQueryBreakpointIndex::CollectBetween(
+    const Vector<Breakpoint>& breakpoints,
+    double old_value,
+    double new_value,
+    Vector<wtf_size_t>& result) {
+  if (old_value == new_value)
+    return;
+  // MediaQueryEvaluator compares lengths with LayoutUnit precision, so make
+  // sure breakpoints just outside the interval are also re-evaluated.
+  const double precision = 2 * LayoutUnit::Epsilon();
+  double low = std::min(old_value, new_value) - precision;
+  double high = std::max(old_value, new_value) + precision;
+  auto* it = std::lower_bound(breakpoints.begin(), breakpoints.end(), low,
+                              [](const Breakpoint& breakpoint, double v) {
+                                return breakpoint.value < v;
+                              });
+  for (; it != breakpoints.end() && it->value <= high; ++it)
+    result.push_back(it->result_index);
+}
+
+Vector<wtf_size_t> MediaQueryBreakpointIndex::CollectAffectedByResize(
+    const gfx::SizeF& new_size) const {
+  DCHECK(viewport_size_);
+  const gfx::SizeF& old_size = *viewport_size_;
+
+  Vector<wtf_size_t> result;
+  result.AppendVector(unindexed_results_);
+  CollectBetween(width_breakpoints_, old_size.width(), new_size.width(),
+                 result);
+  CollectBetween(height_breakpoints_, old_size.height(), new_size.height(),
+                 result);
+  if (IsLandscape(old_size) != IsLandscape(new_size))
+    result.AppendVector(orientation_results_);
+  for (wtf_size_t i = 0; i < aspect_ratios_.size(); ++i) {
+    int old_sign = AspectRatioSign(old_size, aspect_ratios_[i]);
+    if (old_sign != AspectRatioSign(new_size, aspect_ratios_[i]) || !old_sign)
+      result.push_back(aspect_ratio_results_[i]);
+  }
+
+  std::sort(result.begin(), result.end());
+  result.Shrink(static_cast<wtf_size_t>(
+      std::unique(result.begin(), result.end()) - result.begin()));
+  return result;
+}
+
+}  // namespace blink
@@ -0,0 +1,74 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_CSS_MEDIA_QUERY_BREAKPOINT_INDEX_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_MEDIA_QUERY_BREAKPOINT_INDEX_H_
+
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "ui/gfx/geometry/size_f.h"
+
+namespace blink {
+
+class MediaQueryExp;
+class MediaQuerySet;
+
+// Indexes the MediaQuerySets of a RuleSet by the viewport size features they
+// depend on, such that a viewport resize only needs to re-evaluate the sets
+// which may change their result between the old and the new viewport size.
+//
+// MediaQuerySets are identified by their index into the MediaQuerySetResult
+// vector of the RuleSet. Depending on the features used, a set is either:
+//
+//  - Indexed by its width, height and aspect-ratio breakpoints, kept sorted
+//    per feature, when all compared values are absolute lengths.
+//  - Re-evaluated when the orientation flips, for 'orientation'.
+//  - Re-evaluated on every resize, for other viewport or device dependent
+//    features, or relative lengths (e.g. em or vw) in the compared values.
+//  - Never re-evaluated on resize, if it does not depend on the viewport.
+class CORE_EXPORT MediaQueryBreakpointIndex {
+  DISALLOW_NEW();
+
+ public:
+  void Add(const MediaQuerySet&, wtf_size_t result_index);
+
+  // The viewport size the indexed results were last known to be valid for.
+  void SetViewportSize(const gfx::SizeF& size) { viewport_size_ = size; }
+  bool HasViewportSize() const { return viewport_size_.has_value(); }
+
+  // Returns the sorted, unique result indices of the MediaQuerySets which may
+  // evaluate differently for new_size than for the stored viewport size.
+  Vector<wtf_size_t> CollectAffectedByResize(const gfx::SizeF& new_size) const;
+
+ private:
+  struct Breakpoint {
+    double value;
+    wtf_size_t result_index;
+  };
+
+  bool AddExpression(const MediaQueryExp&, wtf_size_t result_index);
+  static void InsertBreakpoint(Vector<Breakpoint>&,
+                               double value,
+                               wtf_size_t result_index);
+  static void CollectBetween(const Vector<Breakpoint>&,
+                             double old_value,
+                             double new_value,
+                             Vector<wtf_size_t>& result);
+
+  Vector<Breakpoint> width_breakpoints_;
+  Vector<Breakpoint> height_breakpoints_;
+  // The aspect-ratio breakpoints are stored as numerator/denominator pairs,
+  // and compared the same way MediaQueryEvaluator does.
+  Vector<std::pair<unsigned, unsigned>> aspect_ratios_;
+  Vector<wtf_size_t> aspect_ratio_results_;
+  Vector<wtf_size_t> orientation_results_;
+  Vector<wtf_size_t> unindexed_results_;
+  absl::optional<gfx::SizeF> viewport_size_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_CSS_MEDIA_QUERY_BREAKPOINT_INDEX_H_
@@ -0,0 +1,101 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/media_query_breakpoint_index.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/css/media_list.h"
+
+namespace blink {
+
+class MediaQueryBreakpointIndexTest : public testing::Test {
+ protected:
+  void Add(const char* media) {
+    index_.Add(*MediaQuerySet::Create(media, nullptr), next_index_++);
+  }
+
+  Vector<wtf_size_t> Resize(float from_width,
+                            float from_height,
+                            float to_width,
+                            float to_height) {
+    index_.SetViewportSize(gfx::SizeF(from_width, from_height));
+    return index_.CollectAffectedByResize(gfx::SizeF(to_width, to_height));
+  }
+
+  MediaQueryBreakpointIndex index_;
+  wtf_size_t next_index_ = 0;
+};
+
+TEST_F(MediaQueryBreakpointIndexTest, NotViewportDependent) {
+  Add("print");
+  Add("(prefers-color-scheme: dark)");
+  Add("(hover) and (color)");
+  EXPECT_TRUE(Resize(500, 500, 1000, 1000).IsEmpty());
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, WidthBreakpoints) {
+  Add("(min-width: 400px)");
+  Add("(max-width: 800px)");
+  Add("(600px <= width < 700px)");
+
+  EXPECT_TRUE(Resize(500, 500, 550, 500).IsEmpty());
+  EXPECT_TRUE(Resize(900, 500, 1200, 300).IsEmpty());
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(300, 500, 500, 500));
+  EXPECT_EQ(Vector<wtf_size_t>({2}), Resize(500, 500, 650, 500));
+  EXPECT_EQ(Vector<wtf_size_t>({1, 2}), Resize(650, 500, 850, 500));
+  EXPECT_EQ(Vector<wtf_size_t>({0, 1, 2}), Resize(900, 500, 300, 500));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, BreakpointOnBoundary) {
+  Add("(min-width: 400px)");
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(399, 500, 400, 500));
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(400, 500, 401, 500));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, AbsoluteUnits) {
+  // 1in = 96px.
+  Add("(min-width: 1in)");
+  EXPECT_TRUE(Resize(50, 50, 90, 50).IsEmpty());
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(90, 50, 100, 50));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, HeightBreakpoints) {
+  Add("(min-height: 400px)");
+  Add("(min-width: 400px)");
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(500, 300, 500, 500));
+  EXPECT_TRUE(Resize(300, 500, 300, 600).IsEmpty());
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, Orientation) {
+  Add("(orientation: portrait)");
+  EXPECT_TRUE(Resize(300, 500, 400, 600).IsEmpty());
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(300, 500, 500, 300));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, AspectRatio) {
+  Add("(min-aspect-ratio: 16/9)");
+  EXPECT_TRUE(Resize(1600, 1000, 1700, 1000).IsEmpty());
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(1000, 1000, 1700, 900));
+  // Exactly on the breakpoint.
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(1600, 900, 1700, 900));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, RelativeUnitsAreUnindexed) {
+  Add("(min-width: 40em)");
+  Add("(min-width: 50vh)");
+  Add("(min-width: calc(100px + 1px))");
+  Add("(min-resolution: 2dppx)");
+  Add("(min-device-width: 100px)");
+  EXPECT_EQ(Vector<wtf_size_t>({0, 1, 2, 3, 4}), Resize(500, 500, 501, 500));
+}
+
+TEST_F(MediaQueryBreakpointIndexTest, MixedFeatures) {
+  Add("screen and (min-width: 400px) and (prefers-reduced-motion)");
+  Add("(max-width: 200px), (min-height: 1000px)");
+  EXPECT_EQ(Vector<wtf_size_t>({0}), Resize(300, 500, 500, 500));
+  EXPECT_EQ(Vector<wtf_size_t>({1}), Resize(500, 500, 500, 1200));
+  EXPECT_EQ(Vector<wtf_size_t>({0, 1}), Resize(100, 500, 500, 500));
+}
+
+}  // namespace blink
@@ -88,6 +88,7 @@ class CORE_EXPORT MediaQueryEvaluator final
 
   ~MediaQueryEvaluator();
 
+  bool HasMediaValues() const { return media_values_; }
   const MediaValues& GetMediaValues() const { return *media_values_; }
 
   bool MediaTypeMatch(const String& media_type_to_match) const;
@@ -38,6 +38,7 @@
 #include "third_party/blink/renderer/core/style/computed_style.h"
 #include "third_party/blink/renderer/core/style_property_shorthand.h"
 #include "third_party/blink/renderer/platform/instrumentation/use_counter.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 
@@ -819,8 +820,18 @@ const CSSValue* StyleCascade::ResolveCustomProperty(
 
   scoped_refptr<CSSVariableData> data = decl.Value();
 
-  if (data->NeedsVariableResolution())
+  if (data->NeedsVariableResolution()) {
+    // The base computed style optimization relies on this to know whether
+    // animated custom properties can affect other declarations. Note that
+    // this makes styles with var() in registered non-inherited custom
+    // properties uncacheable in the MatchedPropertiesCache, so only mark it
+    // when the optimization is enabled.
+    if (RuntimeEnabledFeatures::
+            CSSAnimationBaseStyleForCustomPropertiesEnabled()) {
+      MarkHasVariableReference(property);
+    }
     data = ResolveVariableData(data.get(), resolver);
+  }
 
   if (HasFontSizeDependency(To<CustomProperty>(property), data.get()))
     resolver.DetectCycle(GetCSSPropertyFontSize());
@@ -3059,6 +3059,35 @@ TEST_F(StyleCascadeTest, NoMarkHasVariableReferenceWithoutVar) {
   EXPECT_FALSE(style->HasVariableReferenceFromNonInheritedProperty());
 }
 
+TEST_F(StyleCascadeTest, MarkHasVariableReferenceCustomProperty) {
+  RegisterProperty(GetDocument(), "--y", "<length>", "0px", false);
+
+  {
+    // Without the base computed style optimization for custom property
+    // animations, var() in custom properties doesn't affect the
+    // cacheability of the style.
+    ScopedCSSAnimationBaseStyleForCustomPropertiesForTest base_style(false);
+    TestCascade cascade(GetDocument());
+    cascade.Add("--x", "1px");
+    cascade.Add("--y", "var(--x)");
+    cascade.Apply();
+    auto style = cascade.TakeStyle();
+    EXPECT_FALSE(style->HasVariableReference());
+    EXPECT_FALSE(style->HasVariableReferenceFromNonInheritedProperty());
+  }
+
+  {
+    ScopedCSSAnimationBaseStyleForCustomPropertiesForTest base_style(true);
+    TestCascade cascade(GetDocument());
+    cascade.Add("--x", "1px");
+    cascade.Add("--y", "var(--x)");
+    cascade.Apply();
+    auto style = cascade.TakeStyle();
+    EXPECT_TRUE(style->HasVariableReference());
+    EXPECT_TRUE(style->HasVariableReferenceFromNonInheritedProperty());
+  }
+}
+
 TEST_F(StyleCascadeTest, InternalVisitedColorLonghand) {
   TestCascade cascade(GetDocument());
   cascade.Add("color:green", CascadeOrigin::kAuthor);
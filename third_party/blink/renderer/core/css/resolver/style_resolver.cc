@@ -1923,9 +1923,18 @@ bool StyleResolver::CanReuseBaseComputedStyle(const StyleResolverState& state) {
 
   // Animating a custom property can have side effects on other properties
   // via variable references. Disallow base computed style optimization in such
-  // cases.
-  if (CSSAnimations::IsAnimatingCustomProperties(element_animations))
-    return false;
+  // cases, unless the base style has no variable references at all. Custom
+  // property declarations referencing other variables are marked as variable
+  // references too (see StyleCascade::ResolveCustomProperty()), so the
+  // animated values can only affect the animated custom properties themselves.
+  if (CSSAnimations::IsAnimatingCustomProperties(element_animations)) {
+    if (!RuntimeEnabledFeatures::
+            CSSAnimationBaseStyleForCustomPropertiesEnabled()) {
+      return false;
+    }
+    if (base_data->GetBaseComputedStyle()->HasVariableReference())
+      return false;
+  }
 
   // We need to build the cascade to know what to revert to.
   if (CSSAnimations::IsAnimatingRevert(element_animations))
@@ -370,6 +370,74 @@ INSTANTIATE_TEST_SUITE_P(All,
                          StyleResolverFontRelativeUnitTest,
                          testing::Values("em", "rem", "ex", "ch"));
 
+TEST_F(StyleResolverTest, BaseReusableForCustomPropertyAnimation) {
+  ScopedCSSAnimationBaseStyleForCustomPropertiesForTest scoped_feature(true);
+
+  GetDocument().documentElement()->setInnerHTML(R"HTML(
+    <style>
+      @keyframes anim {
+        from { --x: 10px; }
+        to { --x: 20px; }
+      }
+      div { animation: anim 1s paused; }
+      #var { width: var(--x); }
+      #nested { --y: var(--x); }
+    </style>
+    <div id=plain></div>
+    <div id=var></div>
+    <div id=nested></div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  for (const char* id : {"plain", "var", "nested"}) {
+    Element* div = GetDocument().getElementById(id);
+    ASSERT_TRUE(div->GetElementAnimations()) << id;
+    div->SetNeedsAnimationStyleRecalc();
+  }
+  GetDocument().Lifecycle().AdvanceTo(DocumentLifecycle::kInStyleRecalc);
+
+  EXPECT_FALSE(StyleForId("plain")->HasVariableReference());
+  StyleResolverState plain_state(GetDocument(),
+                                 *GetDocument().getElementById("plain"));
+  EXPECT_TRUE(StyleResolver::CanReuseBaseComputedStyle(plain_state));
+
+  // The animated custom property is referenced by other declarations of the
+  // element, which need to be resolved again.
+  EXPECT_TRUE(StyleForId("var")->HasVariableReference());
+  StyleResolverState var_state(GetDocument(),
+                               *GetDocument().getElementById("var"));
+  EXPECT_FALSE(StyleResolver::CanReuseBaseComputedStyle(var_state));
+
+  EXPECT_TRUE(StyleForId("nested")->HasVariableReference());
+  StyleResolverState nested_state(GetDocument(),
+                                  *GetDocument().getElementById("nested"));
+  EXPECT_FALSE(StyleResolver::CanReuseBaseComputedStyle(nested_state));
+}
+
+TEST_F(StyleResolverTest, BaseNotReusableForCustomPropertyAnimation) {
+  ScopedCSSAnimationBaseStyleForCustomPropertiesForTest scoped_feature(false);
+
+  GetDocument().documentElement()->setInnerHTML(R"HTML(
+    <style>
+      @keyframes anim {
+        from { --x: 10px; }
+        to { --x: 20px; }
+      }
+      div { animation: anim 1s paused; }
+    </style>
+    <div id=div></div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  Element* div = GetDocument().getElementById("div");
+  div->SetNeedsAnimationStyleRecalc();
+  GetDocument().Lifecycle().AdvanceTo(DocumentLifecycle::kInStyleRecalc);
+  EXPECT_TRUE(StyleForId("div")->GetBaseComputedStyle());
+
+  StyleResolverState state(GetDocument(), *div);
+  EXPECT_FALSE(StyleResolver::CanReuseBaseComputedStyle(state));
+}
+
 namespace {
 
 const CSSImageValue& GetBackgroundImageValue(const ComputedStyle& style) {
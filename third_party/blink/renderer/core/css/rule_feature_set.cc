@@ -46,7 +46,11 @@
 #include "third_party/blink/renderer/core/dom/element.h"
 #include "third_party/blink/renderer/core/dom/node.h"
 #include "third_party/blink/renderer/core/inspector/inspector_trace_events.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
+#include "third_party/blink/renderer/platform/wtf/hash_traits.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
 
 namespace blink {
 
@@ -297,6 +301,82 @@ void ExtractInvalidationSets(InvalidationSet* invalidation_set,
   descendants = siblings->Descendants();
 }
 
+// Hash-conses the invalidation sets of the RuleFeatureSets of the main
+// thread. The sets are bucketed by the hash of their serialization, and
+// compared with InvalidationSet::operator== within a bucket.
+//
+// The interned sets are referenced by the interner, so they never have one
+// ref, and EnsureMutableInvalidationSet() copies them before modifying them.
+// The sets which are only referenced by the interner are released when the
+// number of interned sets has doubled.
+class InvalidationSetInterner {
+  USING_FAST_MALLOC(InvalidationSetInterner);
+
+ public:
+  static InvalidationSetInterner& Get() {
+    DEFINE_STATIC_LOCAL(InvalidationSetInterner, interner, {});
+    return interner;
+  }
+
+  void Intern(scoped_refptr<InvalidationSet>& invalidation_set) {
+    // Sets which are already shared are either interned already, or the
+    // interned sets of another RuleFeatureSet added to this one.
+    if (!invalidation_set->HasOneRef() ||
+        invalidation_set->IsSelfInvalidationSet()) {
+      return;
+    }
+    unsigned hash = StringHash::GetHash(invalidation_set->ToString());
+    Bucket& bucket = buckets_.insert(hash, Bucket()).stored_value->value;
+    for (const scoped_refptr<InvalidationSet>& interned : bucket) {
+      if (*interned == *invalidation_set) {
+        invalidation_set = interned;
+        ++deduplicated_count_;
+        return;
+      }
+    }
+    bucket.push_back(invalidation_set);
+    if (++size_ >= remove_unused_size_)
+      RemoveUnused();
+  }
+
+  wtf_size_t size() const { return size_; }
+  wtf_size_t DeduplicatedCount() const { return deduplicated_count_; }
+
+ private:
+  using Bucket = Vector<scoped_refptr<InvalidationSet>, 1>;
+
+  void RemoveUnused() {
+    Vector<unsigned> empty_buckets;
+    size_ = 0;
+    for (auto& entry : buckets_) {
+      Bucket& bucket = entry.value;
+      auto* new_end = std::remove_if(
+          bucket.begin(), bucket.end(),
+          [](const scoped_refptr<InvalidationSet>& invalidation_set) {
+            return invalidation_set->HasOneRef();
+          });
+      bucket.Shrink(static_cast<wtf_size_t>(new_end - bucket.begin()));
+      if (bucket.IsEmpty())
+        empty_buckets.push_back(entry.key);
+      size_ += bucket.size();
+    }
+    for (unsigned hash : empty_buckets)
+      buckets_.erase(hash);
+    remove_unused_size_ = std::max(kMinimumRemoveUnusedSize, size_ * 2);
+  }
+
+  static constexpr wtf_size_t kMinimumRemoveUnusedSize = 256;
+
+  HashMap<unsigned,
+          Bucket,
+          WTF::IntHash<unsigned>,
+          WTF::UnsignedWithZeroKeyHashTraits<unsigned>>
+      buckets_;
+  wtf_size_t size_ = 0;
+  wtf_size_t remove_unused_size_ = kMinimumRemoveUnusedSize;
+  wtf_size_t deduplicated_count_ = 0;
+};
+
 }  // anonymous namespace
 
 InvalidationSet& RuleFeatureSet::EnsureMutableInvalidationSet(
@@ -1718,6 +1798,31 @@ void RuleFeatureSet::Clear() {
   pseudos_in_has_argument_.clear();
 }
 
+void RuleFeatureSet::InternInvalidationSets() {
+  CHECK(is_alive_);
+  if (!RuntimeEnabledFeatures::CSSInternInvalidationSetsEnabled() ||
+      !IsMainThread()) {
+    return;
+  }
+  InvalidationSetInterner& interner = InvalidationSetInterner::Get();
+  for (auto& entry : class_invalidation_sets_)
+    interner.Intern(entry.value);
+  for (auto& entry : attribute_invalidation_sets_)
+    interner.Intern(entry.value);
+  for (auto& entry : id_invalidation_sets_)
+    interner.Intern(entry.value);
+  for (auto& entry : pseudo_invalidation_sets_)
+    interner.Intern(entry.value);
+}
+
+wtf_size_t RuleFeatureSet::InternedInvalidationSetCount() {
+  return InvalidationSetInterner::Get().size();
+}
+
+wtf_size_t RuleFeatureSet::DeduplicatedInvalidationSetCount() {
+  return InvalidationSetInterner::Get().DeduplicatedCount();
+}
+
 bool RuleFeatureSet::HasViewportDependentMediaQueries() const {
   return media_query_result_flags_.is_viewport_dependent;
 }
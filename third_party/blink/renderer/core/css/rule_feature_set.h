@@ -62,6 +62,16 @@ class CORE_EXPORT RuleFeatureSet {
   void Add(const RuleFeatureSet&);
   void Clear();
 
+  // Replaces the class, attribute, id and pseudo invalidation sets with
+  // structurally equal sets shared by all the RuleFeatureSets of the main
+  // thread, e.g. those of other style sheets and documents. The shared sets
+  // are copied before they are modified.
+  void InternInvalidationSets();
+  // The number of sets currently held for sharing, and the number of sets
+  // replaced by a shared set since startup.
+  static wtf_size_t InternedInvalidationSetCount();
+  static wtf_size_t DeduplicatedInvalidationSetCount();
+
   enum SelectorPreMatch { kSelectorNeverMatches, kSelectorMayMatch };
 
   SelectorPreMatch CollectFeaturesFromRuleData(const RuleData*,
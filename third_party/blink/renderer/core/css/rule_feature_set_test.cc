@@ -91,12 +91,21 @@ class RuleFeatureSetTest : public testing::Test {
 
   void ClearFeatures() { rule_feature_set_.Clear(); }
 
+  void InternInvalidationSets() { rule_feature_set_.InternInvalidationSets(); }
+
   void CollectInvalidationSetsForClass(InvalidationLists& invalidation_lists,
                                        const AtomicString& class_name) const {
+    CollectInvalidationSetsForClass(invalidation_lists, class_name,
+                                    rule_feature_set_);
+  }
+
+  void CollectInvalidationSetsForClass(InvalidationLists& invalidation_lists,
+                                       const AtomicString& class_name,
+                                       const RuleFeatureSet& set) const {
     Element* element = Traversal<HTMLElement>::FirstChild(
         *Traversal<HTMLElement>::FirstChild(*document_->body()));
-    rule_feature_set_.CollectInvalidationSetsForClass(invalidation_lists,
-                                                      *element, class_name);
+    set.CollectInvalidationSetsForClass(invalidation_lists, *element,
+                                        class_name);
   }
 
   void CollectInvalidationSetsForId(InvalidationLists& invalidation_lists,
@@ -2538,4 +2547,45 @@ TEST_F(RuleFeatureSetTest, isPseudoContainingComplexInsideHas19) {
   }
 }
 
+TEST_F(RuleFeatureSetTest, InternInvalidationSets) {
+  ScopedCSSInternInvalidationSetsForTest intern_scope(true);
+
+  // The invalidation sets for .a and .b are equal, and so are the ones of
+  // .c in the two RuleFeatureSets.
+  EXPECT_EQ(RuleFeatureSet::kSelectorMayMatch, CollectFeatures(".a .x"));
+  EXPECT_EQ(RuleFeatureSet::kSelectorMayMatch, CollectFeatures(".b .x"));
+  EXPECT_EQ(RuleFeatureSet::kSelectorMayMatch, CollectFeatures(".c .y"));
+  RuleFeatureSet other_set;
+  EXPECT_EQ(RuleFeatureSet::kSelectorMayMatch,
+            CollectFeaturesTo(".c .y", other_set));
+
+  InternInvalidationSets();
+  other_set.InternInvalidationSets();
+
+  InvalidationLists a_lists;
+  CollectInvalidationSetsForClass(a_lists, "a");
+  InvalidationLists b_lists;
+  CollectInvalidationSetsForClass(b_lists, "b");
+  ASSERT_EQ(1u, a_lists.descendants.size());
+  ASSERT_EQ(1u, b_lists.descendants.size());
+  EXPECT_EQ(a_lists.descendants[0], b_lists.descendants[0]);
+
+  InvalidationLists c_lists;
+  CollectInvalidationSetsForClass(c_lists, "c");
+  InvalidationLists other_c_lists;
+  CollectInvalidationSetsForClass(other_c_lists, "c", other_set);
+  ASSERT_EQ(1u, c_lists.descendants.size());
+  ASSERT_EQ(1u, other_c_lists.descendants.size());
+  EXPECT_EQ(c_lists.descendants[0], other_c_lists.descendants[0]);
+
+  // Adding features to a shared set copies it.
+  EXPECT_EQ(RuleFeatureSet::kSelectorMayMatch, CollectFeatures(".a .z"));
+  a_lists.descendants.clear();
+  CollectInvalidationSetsForClass(a_lists, "a");
+  ASSERT_EQ(1u, a_lists.descendants.size());
+  EXPECT_NE(a_lists.descendants[0], b_lists.descendants[0]);
+  ExpectClassInvalidation("x", "z", a_lists.descendants);
+  ExpectClassInvalidation("x", b_lists.descendants);
+}
+
 }  // namespace blink
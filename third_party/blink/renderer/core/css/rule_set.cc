@@ -39,6 +39,7 @@
 #include "third_party/blink/renderer/core/css/css_font_selector.h"
 #include "third_party/blink/renderer/core/css/css_selector.h"
 #include "third_party/blink/renderer/core/css/css_selector_list.h"
+#include "third_party/blink/renderer/core/css/media_values.h"
 #include "third_party/blink/renderer/core/css/selector_filter.h"
 #include "third_party/blink/renderer/core/css/style_rule_import.h"
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
@@ -576,6 +577,20 @@ bool RuleSet::MatchMediaForAddRules(const MediaQueryEvaluator& evaluator,
     return true;
   bool match_media =
       evaluator.Eval(*media_queries, &features_.MutableMediaQueryResultFlags());
+  if (RuntimeEnabledFeatures::CSSMediaQueryBreakpointIndexEnabled()) {
+    if (!media_query_breakpoint_index_.HasViewportSize() &&
+        evaluator.HasMediaValues()) {
+      const MediaValues& media_values = evaluator.GetMediaValues();
+      absl::optional<double> width = media_values.Width();
+      absl::optional<double> height = media_values.Height();
+      if (width && height) {
+        media_query_breakpoint_index_.SetViewportSize(
+            gfx::SizeF(*width, *height));
+      }
+    }
+    media_query_breakpoint_index_.Add(*media_queries,
+                                      media_query_set_results_.size());
+  }
   media_query_set_results_.push_back(
       MediaQuerySetResult(*media_queries, match_media));
   return match_media;
@@ -613,6 +628,11 @@ void RuleSet::AddRulesFromSheet(StyleSheetContents* sheet,
 
   AddChildRules(sheet->ChildRules(), medium, add_rule_flags,
                 nullptr /* container_query */, cascade_layer, nullptr);
+
+  // Large style sheets tend to have many equal invalidation sets, e.g. for
+  // different classes used in the same compound selectors, which can be
+  // shared with other style sheets.
+  features_.InternInvalidationSets();
 }
 
 void RuleSet::AddStyleRule(StyleRule* rule, AddRuleFlags add_rule_flags) {
@@ -918,6 +938,32 @@ bool RuleSet::DidMediaQueryResultsChange(
   return evaluator.DidResultsChange(media_query_set_results_);
 }
 
+bool RuleSet::DidMediaQueryResultsChangeForResize(
+    const MediaQueryEvaluator& evaluator) const {
+  if (!media_query_breakpoint_index_.HasViewportSize() ||
+      !evaluator.HasMediaValues()) {
+    return DidMediaQueryResultsChange(evaluator);
+  }
+  const MediaValues& media_values = evaluator.GetMediaValues();
+  absl::optional<double> width = media_values.Width();
+  absl::optional<double> height = media_values.Height();
+  if (!width || !height)
+    return DidMediaQueryResultsChange(evaluator);
+
+  gfx::SizeF new_size(*width, *height);
+  for (wtf_size_t index :
+       media_query_breakpoint_index_.CollectAffectedByResize(new_size)) {
+    const MediaQuerySetResult& result = media_query_set_results_[index];
+    if (result.Result() != evaluator.Eval(result.MediaQueries()))
+      return true;
+  }
+  // None of the results changed, which means they are all valid for the new
+  // size. Resizes relative to the new size only need to look at the
+  // breakpoints between the new size and the next one.
+  media_query_breakpoint_index_.SetViewportSize(new_size);
+  return false;
+}
+
 const CascadeLayer* RuleSet::GetLayerForTest(const RuleData& rule) const {
   if (!layer_intervals_.size() ||
       layer_intervals_[0].start_position > rule.GetPosition())
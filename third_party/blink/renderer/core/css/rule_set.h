@@ -29,6 +29,7 @@
 #include "third_party/blink/renderer/core/css/cascade_layer.h"
 #include "third_party/blink/renderer/core/css/css_keyframes_rule.h"
 #include "third_party/blink/renderer/core/css/css_position_fallback_rule.h"
+#include "third_party/blink/renderer/core/css/media_query_breakpoint_index.h"
 #include "third_party/blink/renderer/core/css/media_query_evaluator.h"
 #include "third_party/blink/renderer/core/css/resolver/media_query_result.h"
 #include "third_party/blink/renderer/core/css/rule_feature_set.h"
@@ -457,6 +458,12 @@ class CORE_EXPORT RuleSet final : public GarbageCollected<RuleSet> {
   }
 
   bool DidMediaQueryResultsChange(const MediaQueryEvaluator& evaluator) const;
+  // Same as DidMediaQueryResultsChange(), but assumes that only the viewport
+  // size changed since the results were last known to be valid. Only the
+  // MediaQuerySets with breakpoints between the old and the new viewport size
+  // are re-evaluated.
+  bool DidMediaQueryResultsChangeForResize(
+      const MediaQueryEvaluator& evaluator) const;
 
   // We use a vector of Interval<T> to represent that rules with positions
   // between start_position (inclusive) and the next Interval<T>'s
@@ -606,6 +613,9 @@ class CORE_EXPORT RuleSet final : public GarbageCollected<RuleSet> {
   HeapVector<Member<StyleRuleCounterStyle>> counter_style_rules_;
   HeapVector<Member<StyleRulePositionFallback>> position_fallback_rules_;
   HeapVector<MediaQuerySetResult> media_query_set_results_;
+  // Updated with the new viewport size when a resize did not change any of
+  // the media_query_set_results_.
+  mutable MediaQueryBreakpointIndex media_query_breakpoint_index_;
 
   // Whether there is a ruleset bucket for rules with a selector on
   // the style attribute (which is rare, but allowed). If so, the caller
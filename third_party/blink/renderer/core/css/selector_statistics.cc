@@ -4,10 +4,51 @@
 
 #include "third_party/blink/renderer/core/css/selector_statistics.h"
 
+#include <algorithm>
+
 #include "third_party/blink/renderer/core/css/rule_set.h"
 
 namespace blink {
 
+const char* SelectorStatisticsBucketName(SelectorStatisticsBucket bucket) {
+  switch (bucket) {
+    case SelectorStatisticsBucket::kId:
+      return "id";
+    case SelectorStatisticsBucket::kClass:
+      return "class";
+    case SelectorStatisticsBucket::kAttr:
+      return "attr";
+    case SelectorStatisticsBucket::kTag:
+      return "tag";
+    case SelectorStatisticsBucket::kUniversal:
+      return "universal";
+    case SelectorStatisticsBucket::kUAShadowPseudo:
+      return "ua_shadow_pseudo";
+    case SelectorStatisticsBucket::kCue:
+      return "cue";
+    case SelectorStatisticsBucket::kLinkPseudoClass:
+      return "link_pseudo_class";
+    case SelectorStatisticsBucket::kVisitedDependent:
+      return "visited_dependent";
+    case SelectorStatisticsBucket::kFocusPseudoClass:
+      return "focus_pseudo_class";
+    case SelectorStatisticsBucket::kSelectorFragmentAnchor:
+      return "selector_fragment_anchor";
+    case SelectorStatisticsBucket::kFocusVisiblePseudoClass:
+      return "focus_visible_pseudo_class";
+    case SelectorStatisticsBucket::kSpatialNavigationInterestPseudoClass:
+      return "spatial_navigation_interest_pseudo_class";
+    case SelectorStatisticsBucket::kShadowHost:
+      return "shadow_host";
+    case SelectorStatisticsBucket::kSlotted:
+      return "slotted";
+    case SelectorStatisticsBucket::kPart:
+      return "part";
+  }
+  NOTREACHED();
+  return "";
+}
+
 void SelectorStatisticsCollector::ReserveCapacity(wtf_size_t size) {
   per_rule_statistics_.ReserveCapacity(size);
 }
@@ -27,4 +68,53 @@ void SelectorStatisticsCollector::EndCollectionForCurrentRule() {
   rule_ = nullptr;
 }
 
+double SelectorStatisticsReport::Counts::FastRejectRatio() const {
+  return match_attempts
+             ? static_cast<double>(fast_reject_count) / match_attempts
+             : 0;
+}
+
+double SelectorStatisticsReport::Counts::MatchRatio() const {
+  int checked = match_attempts - fast_reject_count;
+  return checked ? static_cast<double>(match_count) / checked : 0;
+}
+
+void SelectorStatisticsReport::Add(const String& selector_text,
+                                   const String& style_sheet_name,
+                                   SelectorStatisticsBucket bucket,
+                                   const Counts& counts) {
+  per_selector_.insert(selector_text, Counts()).stored_value->value.Add(counts);
+  per_style_sheet_.insert(style_sheet_name, Counts())
+      .stored_value->value.Add(counts);
+  per_bucket_[static_cast<wtf_size_t>(bucket)].Add(counts);
+  total_.Add(counts);
+}
+
+Vector<std::pair<String, SelectorStatisticsReport::Counts>>
+SelectorStatisticsReport::TopSelectors(wtf_size_t count) const {
+  Vector<std::pair<String, Counts>> selectors;
+  selectors.ReserveInitialCapacity(per_selector_.size());
+  for (const auto& entry : per_selector_)
+    selectors.push_back(std::make_pair(entry.key, entry.value));
+  count = std::min(count, selectors.size());
+  std::partial_sort(
+      selectors.begin(), selectors.begin() + count, selectors.end(),
+      [](const std::pair<String, Counts>& a,
+         const std::pair<String, Counts>& b) {
+        if (a.second.elapsed != b.second.elapsed)
+          return a.second.elapsed > b.second.elapsed;
+        // Keep the order deterministic for selectors with the same cost.
+        return WTF::CodeUnitCompareLessThan(a.first, b.first);
+      });
+  selectors.Shrink(count);
+  return selectors;
+}
+
+void SelectorStatisticsReport::Clear() {
+  per_selector_.clear();
+  per_style_sheet_.clear();
+  per_bucket_.fill(Counts());
+  total_ = Counts();
+}
+
 }  // namespace blink
@@ -5,13 +5,48 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_STATISTICS_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_CSS_SELECTOR_STATISTICS_H_
 
+#include <array>
+#include <utility>
+
 #include "base/time/time.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace blink {
 
 class RuleData;
 
+// The RuleSet bucket which a rule was collected from for matching. The id,
+// class, attribute and tag buckets are the RuleMaps keyed by the element's
+// identifiers; the others are the plain rule lists of the RuleSet.
+enum class SelectorStatisticsBucket : uint8_t {
+  kId,
+  kClass,
+  kAttr,
+  kTag,
+  kUniversal,
+  kUAShadowPseudo,
+  kCue,
+  kLinkPseudoClass,
+  kVisitedDependent,
+  kFocusPseudoClass,
+  kSelectorFragmentAnchor,
+  kFocusVisiblePseudoClass,
+  kSpatialNavigationInterestPseudoClass,
+  kShadowHost,
+  kSlotted,
+  kPart,
+};
+
+constexpr wtf_size_t kSelectorStatisticsBucketCount =
+    static_cast<wtf_size_t>(SelectorStatisticsBucket::kPart) + 1;
+
+CORE_EXPORT const char* SelectorStatisticsBucketName(SelectorStatisticsBucket);
+
 struct RulePerfDataPerRequest {
   RulePerfDataPerRequest(const RuleData* r, bool f, bool m, base::TimeDelta e)
       : rule(r), fast_reject(f), did_match(m), elapsed(e) {}
@@ -65,6 +100,66 @@ class SelectorStatisticsCollector {
   bool did_match_{false};
 };
 
+// Aggregates the selector statistics of style recalc passes, such that the
+// style recalc cost can be attributed to selectors, style sheets and RuleSet
+// buckets. See ElementRuleCollector::SetSelectorStatisticsReportForTesting().
+class CORE_EXPORT SelectorStatisticsReport {
+  USING_FAST_MALLOC(SelectorStatisticsReport);
+
+ public:
+  struct Counts {
+    DISALLOW_NEW();
+
+    void Add(const Counts& other) {
+      match_attempts += other.match_attempts;
+      fast_reject_count += other.fast_reject_count;
+      match_count += other.match_count;
+      elapsed += other.elapsed;
+    }
+    // The ratio of match attempts which were rejected by the selector filter,
+    // before running the SelectorChecker.
+    double FastRejectRatio() const;
+    // The ratio of matches for the match attempts which were not fast
+    // rejected.
+    double MatchRatio() const;
+
+    int match_attempts = 0;
+    int fast_reject_count = 0;
+    int match_count = 0;
+    base::TimeDelta elapsed;
+  };
+
+  // The number of selectors which are usually reported as the most expensive
+  // ones.
+  static constexpr wtf_size_t kTopSelectorCount = 20;
+
+  void Add(const String& selector_text,
+           const String& style_sheet_name,
+           SelectorStatisticsBucket,
+           const Counts&);
+
+  // Returns the selectors with the highest elapsed time, most expensive first.
+  Vector<std::pair<String, Counts>> TopSelectors(wtf_size_t count) const;
+
+  const HashMap<String, Counts>& PerSelector() const { return per_selector_; }
+  const HashMap<String, Counts>& PerStyleSheet() const {
+    return per_style_sheet_;
+  }
+  const Counts& PerBucket(SelectorStatisticsBucket bucket) const {
+    return per_bucket_[static_cast<wtf_size_t>(bucket)];
+  }
+  const Counts& Total() const { return total_; }
+  bool IsEmpty() const { return !total_.match_attempts; }
+
+  void Clear();
+
+ private:
+  HashMap<String, Counts> per_selector_;
+  HashMap<String, Counts> per_style_sheet_;
+  std::array<Counts, kSelectorStatisticsBucketCount> per_bucket_;
+  Counts total_;
+};
+
 }  // namespace blink
 
 WTF_ALLOW_CLEAR_UNUSED_SLOTS_WITH_MEM_FUNCTIONS(blink::RulePerfDataPerRequest)
@@ -0,0 +1,178 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/css/selector_statistics.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/css/element_rule_collector.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/dom_node_ids.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/testing/page_test_base.h"
+
+namespace blink {
+
+namespace {
+
+SelectorStatisticsReport::Counts MakeCounts(int match_attempts,
+                                            int fast_reject_count,
+                                            int match_count,
+                                            int elapsed_us) {
+  SelectorStatisticsReport::Counts counts;
+  counts.match_attempts = match_attempts;
+  counts.fast_reject_count = fast_reject_count;
+  counts.match_count = match_count;
+  counts.elapsed = base::Microseconds(elapsed_us);
+  return counts;
+}
+
+}  // namespace
+
+class SelectorStatisticsTest : public PageTestBase {
+ protected:
+  void SetUp() override {
+    PageTestBase::SetUp();
+    ElementRuleCollector::SetSelectorStatisticsReportForTesting(&report_);
+  }
+
+  void TearDown() override {
+    ElementRuleCollector::SetSelectorStatisticsReportForTesting(nullptr);
+    PageTestBase::TearDown();
+  }
+
+  SelectorStatisticsReport report_;
+};
+
+TEST(SelectorStatisticsReportTest, Aggregate) {
+  SelectorStatisticsReport report;
+  EXPECT_TRUE(report.IsEmpty());
+
+  report.Add(".a .b", "a.css", SelectorStatisticsBucket::kClass,
+             MakeCounts(10, 6, 2, 100));
+  report.Add(".a .b", "a.css", SelectorStatisticsBucket::kClass,
+             MakeCounts(10, 4, 1, 50));
+  report.Add("div", "b.css", SelectorStatisticsBucket::kTag,
+             MakeCounts(4, 0, 4, 20));
+  report.Add("*", "b.css", SelectorStatisticsBucket::kUniversal,
+             MakeCounts(8, 0, 0, 200));
+  EXPECT_FALSE(report.IsEmpty());
+
+  EXPECT_EQ(32, report.Total().match_attempts);
+  EXPECT_EQ(10, report.Total().fast_reject_count);
+  EXPECT_EQ(7, report.Total().match_count);
+  EXPECT_EQ(base::Microseconds(370), report.Total().elapsed);
+
+  ASSERT_EQ(3u, report.PerSelector().size());
+  const SelectorStatisticsReport::Counts& ab = report.PerSelector().at(".a .b");
+  EXPECT_EQ(20, ab.match_attempts);
+  EXPECT_DOUBLE_EQ(0.5, ab.FastRejectRatio());
+  EXPECT_DOUBLE_EQ(0.3, ab.MatchRatio());
+
+  ASSERT_EQ(2u, report.PerStyleSheet().size());
+  EXPECT_EQ(base::Microseconds(150),
+            report.PerStyleSheet().at("a.css").elapsed);
+  EXPECT_EQ(base::Microseconds(220),
+            report.PerStyleSheet().at("b.css").elapsed);
+
+  EXPECT_EQ(20, report.PerBucket(SelectorStatisticsBucket::kClass)
+                    .match_attempts);
+  EXPECT_DOUBLE_EQ(
+      1, report.PerBucket(SelectorStatisticsBucket::kTag).MatchRatio());
+  EXPECT_EQ(0, report.PerBucket(SelectorStatisticsBucket::kId).match_attempts);
+
+  auto top = report.TopSelectors(2);
+  ASSERT_EQ(2u, top.size());
+  EXPECT_EQ("*", top[0].first);
+  EXPECT_EQ(".a .b", top[1].first);
+  EXPECT_EQ(3u, report.TopSelectors(10).size());
+
+  report.Clear();
+  EXPECT_TRUE(report.IsEmpty());
+  EXPECT_TRUE(report.PerSelector().IsEmpty());
+  EXPECT_EQ(0, report.PerBucket(SelectorStatisticsBucket::kClass)
+                   .match_attempts);
+}
+
+TEST(SelectorStatisticsReportTest, RatiosWithoutAttempts) {
+  SelectorStatisticsReport::Counts counts;
+  EXPECT_EQ(0, counts.FastRejectRatio());
+  EXPECT_EQ(0, counts.MatchRatio());
+
+  // All the attempts were fast rejected.
+  counts = MakeCounts(3, 3, 0, 1);
+  EXPECT_DOUBLE_EQ(1, counts.FastRejectRatio());
+  EXPECT_EQ(0, counts.MatchRatio());
+}
+
+TEST_F(SelectorStatisticsTest, CollectedForStyleRecalc) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      #target { color: green }
+      .item span { color: red }
+      span { color: blue }
+    </style>
+    <div id=target></div>
+    <div class=item><span></span></div>
+    <span></span>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  const SelectorStatisticsReport& report = report_;
+  EXPECT_FALSE(report.IsEmpty());
+
+  const HashMap<String, SelectorStatisticsReport::Counts>& per_selector =
+      report.PerSelector();
+  ASSERT_TRUE(per_selector.Contains("#target"));
+  EXPECT_EQ(1, per_selector.at("#target").match_count);
+  ASSERT_TRUE(per_selector.Contains(".item span"));
+  EXPECT_EQ(1, per_selector.at(".item span").match_count);
+  ASSERT_TRUE(per_selector.Contains("span"));
+  EXPECT_EQ(2, per_selector.at("span").match_count);
+
+  // The author rules are attributed to the inline style sheet, and the UA
+  // rules to no style sheet.
+  EXPECT_TRUE(report.PerStyleSheet().Contains("<no style sheet>"));
+  Node* style = GetDocument().QuerySelector("style");
+  String style_sheet_name = "<inline style sheet of node " +
+                            String::Number(DOMNodeIds::IdForNode(style)) + ">";
+  ASSERT_TRUE(report.PerStyleSheet().Contains(style_sheet_name));
+  EXPECT_EQ(4, report.PerStyleSheet().at(style_sheet_name).match_count);
+
+  EXPECT_LE(1, report.PerBucket(SelectorStatisticsBucket::kId).match_count);
+  EXPECT_LE(3, report.PerBucket(SelectorStatisticsBucket::kTag).match_count);
+}
+
+TEST_F(SelectorStatisticsTest, AggregatedAcrossPasses) {
+  GetDocument().body()->setInnerHTML(R"HTML(
+    <style>
+      span { color: blue }
+    </style>
+    <span></span>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  const SelectorStatisticsReport& report = report_;
+  ASSERT_TRUE(report.PerSelector().Contains("span"));
+  int match_count = report.PerSelector().at("span").match_count;
+  EXPECT_LE(1, match_count);
+  wtf_size_t style_sheet_count = report.PerStyleSheet().size();
+
+  // The passes are added up, and the same style sheet is reported under the
+  // same name in the next pass.
+  GetDocument().body()->AppendChild(
+      GetDocument().CreateRawElement(html_names::kSpanTag));
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_LT(match_count, report.PerSelector().at("span").match_count);
+  EXPECT_EQ(style_sheet_count, report.PerStyleSheet().size());
+
+  // Once the report is unset, the passes are no longer added to it.
+  match_count = report.PerSelector().at("span").match_count;
+  ElementRuleCollector::SetSelectorStatisticsReportForTesting(nullptr);
+  GetDocument().body()->AppendChild(
+      GetDocument().CreateRawElement(html_names::kSpanTag));
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(match_count, report.PerSelector().at("span").match_count);
+}
+
+}  // namespace blink
@@ -37,8 +37,10 @@
 #include "third_party/blink/renderer/core/animation/document_animations.h"
 #include "third_party/blink/renderer/core/css/cascade_layer_map.h"
 #include "third_party/blink/renderer/core/css/check_pseudo_has_cache_scope.h"
+#include "third_party/blink/renderer/core/css/check_pseudo_has_persistent_cache.h"
 #include "third_party/blink/renderer/core/css/container_query_data.h"
 #include "third_party/blink/renderer/core/css/container_query_evaluator.h"
+#include "third_party/blink/renderer/core/css/container_query_result_cache.h"
 #include "third_party/blink/renderer/core/css/counter_style_map.h"
 #include "third_party/blink/renderer/core/css/css_default_style_sheets.h"
 #include "third_party/blink/renderer/core/css/css_font_family_value.h"
@@ -399,8 +401,10 @@ void StyleEngine::MediaQueryAffectingValueChanged(TreeScope& tree_scope,
                                                   MediaValueChange change) {
   auto* collection = StyleSheetCollectionFor(tree_scope);
   DCHECK(collection);
-  if (AffectedByMediaValueChange(collection->ActiveStyleSheets(), change))
+  if (AffectedByMediaValueChange(collection->ActiveStyleSheets(), change,
+                                 EnsureMediaQueryEvaluator())) {
     SetNeedsActiveStyleUpdate(tree_scope);
+  }
 }
 
 void StyleEngine::WatchedSelectorsChanged() {
@@ -473,8 +477,10 @@ void StyleEngine::MediaQueryAffectingValueChanged(
 }
 
 void StyleEngine::MediaQueryAffectingValueChanged(MediaValueChange change) {
-  if (AffectedByMediaValueChange(active_user_style_sheets_, change))
+  if (AffectedByMediaValueChange(active_user_style_sheets_, change,
+                                 EnsureMediaQueryEvaluator())) {
     MarkUserStyleDirty();
+  }
   MediaQueryAffectingValueChanged(GetDocument(), change);
   MediaQueryAffectingValueChanged(active_tree_scopes_, change);
   MediaQueryAffectingValueChanged(text_tracks_, change);
@@ -934,6 +940,8 @@ void StyleEngine::FontsNeedUpdate(FontSelector*, FontInvalidationReason) {
 
   if (resolver_)
     resolver_->InvalidateMatchedPropertiesCache();
+  if (container_query_result_cache_)
+    container_query_result_cache_->Clear();
   MarkViewportStyleDirty();
   MarkFontsNeedUpdate();
 
@@ -1043,6 +1051,11 @@ inline Element* SelfOrPreviousSibling(Node* node) {
 
 void StyleEngine::InvalidateElementAffectedByHas(Element& element,
                                                  bool for_pseudo_change) {
+  // The :has() state of the element may change, regardless of which :has()
+  // argument is affected.
+  if (check_pseudo_has_persistent_cache_)
+    check_pseudo_has_persistent_cache_->Invalidate(element);
+
   if (for_pseudo_change && !element.AffectedByPseudoInHas())
     return;
 
@@ -1695,6 +1708,11 @@ void StyleEngine::ScheduleInvalidationsForHasPseudoAffectedByRemoval(
   }
 }
 
+void StyleEngine::ElementRemovedForPseudoHas(const Element& element) {
+  if (check_pseudo_has_persistent_cache_)
+    check_pseudo_has_persistent_cache_->Invalidate(element);
+}
+
 void StyleEngine::InvalidateStyle() {
   StyleInvalidator style_invalidator(
       pending_invalidations_.GetPendingInvalidationMap());
@@ -2068,6 +2086,13 @@ void StyleEngine::ApplyUserRuleSetChanges(
   // With rules added or removed, we need to re-aggregate rule meta data.
   global_rule_set_->MarkDirty();
 
+  // Don't keep results for container queries or :has() arguments which may no
+  // longer be in use.
+  if (container_query_result_cache_)
+    container_query_result_cache_->Clear();
+  if (check_pseudo_has_persistent_cache_)
+    check_pseudo_has_persistent_cache_->Clear();
+
   unsigned changed_rule_flags = GetRuleSetFlags(changed_rule_sets);
 
   // Cascade layer map must be built before adding other at-rules, because other
@@ -2191,6 +2216,13 @@ void StyleEngine::ApplyRuleSetChanges(
   // With rules added or removed, we need to re-aggregate rule meta data.
   global_rule_set_->MarkDirty();
 
+  // Don't keep results for container queries or :has() arguments which may no
+  // longer be in use.
+  if (container_query_result_cache_)
+    container_query_result_cache_->Clear();
+  if (check_pseudo_has_persistent_cache_)
+    check_pseudo_has_persistent_cache_->Clear();
+
   if (changed_rule_flags & kKeyframesRules)
     ScopedStyleResolver::KeyframesRulesAdded(tree_scope);
 
@@ -2322,6 +2354,14 @@ void StyleEngine::ApplyVisionDeficiencyStyle(
   }
 }
 
+ContainerQueryResultCache& StyleEngine::EnsureContainerQueryResultCache() {
+  if (!container_query_result_cache_) {
+    container_query_result_cache_ =
+        MakeGarbageCollected<ContainerQueryResultCache>();
+  }
+  return *container_query_result_cache_;
+}
+
 const MediaQueryEvaluator& StyleEngine::EnsureMediaQueryEvaluator() {
   if (!media_query_evaluator_) {
     if (GetDocument().GetFrame()) {
@@ -2732,7 +2772,16 @@ void StyleEngine::RecalcStyle(StyleRecalcChange change,
                               const StyleRecalcContext& style_recalc_context) {
   DCHECK(GetDocument().documentElement());
   ScriptForbiddenScope forbid_script;
-  CheckPseudoHasCacheScope check_pseudo_has_cache_scope(&GetDocument());
+  CheckPseudoHasPersistentCache* check_pseudo_has_persistent_cache = nullptr;
+  if (RuntimeEnabledFeatures::CSSPseudoHasPersistentCacheEnabled()) {
+    if (!check_pseudo_has_persistent_cache_) {
+      check_pseudo_has_persistent_cache_ =
+          MakeGarbageCollected<CheckPseudoHasPersistentCache>();
+    }
+    check_pseudo_has_persistent_cache = check_pseudo_has_persistent_cache_;
+  }
+  CheckPseudoHasCacheScope check_pseudo_has_cache_scope(
+      &GetDocument(), check_pseudo_has_persistent_cache);
   Element& root_element = style_recalc_root_.RootElement();
   Element* parent = FlatTreeTraversal::ParentElement(root_element);
 
@@ -3335,6 +3384,8 @@ void StyleEngine::Trace(Visitor* visitor) const {
   visitor->Trace(vision_deficiency_filter_);
   visitor->Trace(viewport_resolver_);
   visitor->Trace(media_query_evaluator_);
+  visitor->Trace(container_query_result_cache_);
+  visitor->Trace(check_pseudo_has_persistent_cache_);
   visitor->Trace(global_rule_set_);
   visitor->Trace(pending_invalidations_);
   visitor->Trace(style_invalidation_root_);
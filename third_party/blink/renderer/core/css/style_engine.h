@@ -77,6 +77,8 @@ class CSSFontSelector;
 class CSSPropertyValueSet;
 class CSSStyleSheet;
 class CSSValue;
+class CheckPseudoHasPersistentCache;
+class ContainerQueryResultCache;
 class Document;
 class DocumentStyleSheetCollection;
 class ElementRuleCollector;
@@ -425,6 +427,13 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
       Element* parent,
       Node* node_before_change,
       Element& element);
+  // Drop the persisted :has() checking results of an element removed from the
+  // document. See CheckPseudoHasPersistentCache.
+  void ElementRemovedForPseudoHas(const Element&);
+  CheckPseudoHasPersistentCache* GetCheckPseudoHasPersistentCacheForTesting()
+      const {
+    return check_pseudo_has_persistent_cache_.Get();
+  }
 
   void NodeWillBeRemoved(Node&);
   void ChildrenRemoved(ContainerNode& parent);
@@ -529,6 +538,9 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
       return To<Element>(style_recalc_root_.GetRootNode());
     return nullptr;
   }
+  // Container query results shared between size containers with the same
+  // size. See ContainerQueryResultCache.
+  ContainerQueryResultCache& EnsureContainerQueryResultCache();
   void ChangeRenderingForHTMLSelect(HTMLSelectElement& select);
   void DetachedFromParent(LayoutObject* parent) {
     // This method will be called for every LayoutObject while detaching a
@@ -826,6 +838,8 @@ class CORE_EXPORT StyleEngine final : public GarbageCollected<StyleEngine>,
   Member<ViewportStyleResolver> viewport_resolver_;
   Member<MediaQueryEvaluator> media_query_evaluator_;
   Member<CSSGlobalRuleSet> global_rule_set_;
+  Member<ContainerQueryResultCache> container_query_result_cache_;
+  Member<CheckPseudoHasPersistentCache> check_pseudo_has_persistent_cache_;
 
   // This is the default UA generated style sheet for the ::transition* pseudo
   // elements. This is tracked by StyleEngine as opposed to
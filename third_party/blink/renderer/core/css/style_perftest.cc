@@ -18,22 +18,29 @@
 #include "testing/perf/perf_test.h"
 #include "third_party/blink/public/platform/web_back_forward_cache_loader_helper.h"
 #include "third_party/blink/renderer/core/css/container_query_data.h"
+#include "third_party/blink/renderer/core/css/element_rule_collector.h"
 #include "third_party/blink/renderer/core/css/parser/css_tokenizer.h"
+#include "third_party/blink/renderer/core/css/rule_feature_set.h"
 #include "third_party/blink/renderer/core/css/style_change_reason.h"
 #include "third_party/blink/renderer/core/css/style_engine.h"
 #include "third_party/blink/renderer/core/css/style_sheet_contents.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/dom_token_list.h"
 #include "third_party/blink/renderer/core/dom/node_computed_style.h"
+#include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/html/html_body_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/loader/empty_clients.h"
 #include "third_party/blink/renderer/core/style/computed_style.h"
 #include "third_party/blink/renderer/core/testing/no_network_web_url_loader.h"
 #include "third_party/blink/renderer/core/testing/page_test_base.h"
 #include "third_party/blink/renderer/platform/heap/process_heap.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/url_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 
 namespace blink {
 
@@ -84,6 +91,8 @@ static std::unique_ptr<DummyPageHolder> LoadDumpedPage(
   }
   base::TimeDelta tokenize_time = tokenize_timer.Elapsed();
 
+  size_t orig_parse_allocated_bytes =
+      blink::ProcessHeap::TotalAllocatedObjectSize();
   base::ElapsedTimer parse_timer;
   int tokenizer_idx = 0;
   for (const base::Value& sheet_json : *dict.FindList("stylesheets")) {
@@ -105,6 +114,9 @@ static std::unique_ptr<DummyPageHolder> LoadDumpedPage(
     num_bytes += sheet_dict.FindString("text")->size();
   }
   base::TimeDelta parse_time = parse_timer.Elapsed();
+  size_t parse_allocated_bytes =
+      blink::ProcessHeap::TotalAllocatedObjectSize() -
+      orig_parse_allocated_bytes;
 
   reporter.RegisterFyiMetric("NumSheets", "");
   reporter.AddResult("NumSheets", static_cast<double>(num_sheets));
@@ -120,9 +132,61 @@ static std::unique_ptr<DummyPageHolder> LoadDumpedPage(
   reporter.RegisterImportantMetric("ParseTime", "us");
   reporter.AddResult("ParseTime", parse_time);
 
+  // The GC allocations of parsing, which include the CSSValues which are not
+  // shared through the CSSValuePool.
+  reporter.RegisterImportantMetric("ParseGCAllocated", "kB");
+  reporter.AddResult("ParseGCAllocated",
+                     static_cast<double>(parse_allocated_bytes / 1024));
+
   return page;
 }
 
+static void PrintSelectorStatisticsCounts(
+    const SelectorStatisticsReport::Counts& counts,
+    const char* name) {
+  printf("  %8.0f us %8d attempts %5.1f%% fast rejected %5.1f%% matched  %s\n",
+         counts.elapsed.InMicrosecondsF(), counts.match_attempts,
+         100.0 * counts.FastRejectRatio(), 100.0 * counts.MatchRatio(), name);
+}
+
+// Reports where the style recalc time of a dumped page went, per selector,
+// style sheet and RuleSet bucket. Note that collecting the statistics slows
+// down rule matching considerably, so the timings of a run with
+// --selector-stats should not be compared against a run without it.
+static void ReportSelectorStatistics(const SelectorStatisticsReport& report,
+                                     perf_test::PerfResultReporter& reporter,
+                                     const char* label) {
+
+  reporter.RegisterFyiMetric("SelectorMatchTime", "us");
+  reporter.AddResult("SelectorMatchTime", report.Total().elapsed);
+  reporter.RegisterFyiMetric("SelectorMatchAttempts", "");
+  reporter.AddResult("SelectorMatchAttempts",
+                     static_cast<double>(report.Total().match_attempts));
+  reporter.RegisterFyiMetric("SelectorFastRejectRatio", "%");
+  reporter.AddResult("SelectorFastRejectRatio",
+                     100.0 * report.Total().FastRejectRatio());
+  reporter.RegisterFyiMetric("SelectorMatchRatio", "%");
+  reporter.AddResult("SelectorMatchRatio",
+                     100.0 * report.Total().MatchRatio());
+
+  printf("%s: top selectors by match time\n", label);
+  for (const auto& entry :
+       report.TopSelectors(SelectorStatisticsReport::kTopSelectorCount)) {
+    PrintSelectorStatisticsCounts(entry.second, entry.first.Utf8().c_str());
+  }
+  printf("%s: match time by style sheet\n", label);
+  for (const auto& entry : report.PerStyleSheet())
+    PrintSelectorStatisticsCounts(entry.value, entry.key.Utf8().c_str());
+  printf("%s: match time by RuleSet bucket\n", label);
+  for (wtf_size_t i = 0; i < kSelectorStatisticsBucketCount; ++i) {
+    auto bucket = static_cast<SelectorStatisticsBucket>(i);
+    if (report.PerBucket(bucket).match_attempts) {
+      PrintSelectorStatisticsCounts(report.PerBucket(bucket),
+                                    SelectorStatisticsBucketName(bucket));
+    }
+  }
+}
+
 static void MeasureStyleForDumpedPage(const char* filename, const char* label) {
   base::test::ScopedFeatureList feature_list;
   if (base::CommandLine::ForCurrentProcess()->HasSwitch(
@@ -135,6 +199,13 @@ static void MeasureStyleForDumpedPage(const char* filename, const char* label) {
         /*enabled_features=*/{blink::features::kCSSParserSelectorArena},
         /*disabled_features=*/{});
   }
+  // Compare the memory metrics of a run with --intern-invalidation-sets
+  // against one without it to see how much sharing the invalidation sets
+  // saves. Without the switch, the runtime flag keeps its default.
+  ScopedCSSInternInvalidationSetsForTest intern_invalidation_sets(
+      RuntimeEnabledFeatures::CSSInternInvalidationSetsEnabled() ||
+      base::CommandLine::ForCurrentProcess()->HasSwitch(
+          "intern-invalidation-sets"));
 
   // Running more than once is useful for profiling. (If this flag does not
   // exist, it will return the empty string.)
@@ -157,6 +228,8 @@ static void MeasureStyleForDumpedPage(const char* filename, const char* label) {
       blink::ProcessHeap::TotalAllocatedObjectSize();
   size_t orig_partition_allocated_bytes =
       WTF::Partitions::TotalSizeOfCommittedPages();
+  wtf_size_t orig_deduplicated_invalidation_sets =
+      RuleFeatureSet::DeduplicatedInvalidationSetCount();
 
   std::unique_ptr<DummyPageHolder> page;
 
@@ -174,6 +247,17 @@ static void MeasureStyleForDumpedPage(const char* filename, const char* label) {
     page = LoadDumpedPage(json->GetDict(), reporter);
   }
 
+  // If --selector-stats is given, the style recalcs below collect selector
+  // statistics (as when the blink.debug trace category is enabled), and the
+  // aggregated report is printed at the end.
+  const bool selector_stats =
+      base::CommandLine::ForCurrentProcess()->HasSwitch("selector-stats");
+  SelectorStatisticsReport selector_statistics;
+  if (selector_stats) {
+    ElementRuleCollector::SetSelectorStatisticsReportForTesting(
+        &selector_statistics);
+  }
+
   {
     base::ElapsedTimer style_timer;
     for (int i = 0; i < recalc_iterations; ++i) {
@@ -210,6 +294,208 @@ static void MeasureStyleForDumpedPage(const char* filename, const char* label) {
   reporter.AddResult(
       "PartitionAllocated",
       (partition_allocated_bytes - orig_partition_allocated_bytes) / 1024);
+  reporter.RegisterFyiMetric("InvalidationSetsDeduplicated", "");
+  reporter.AddResult(
+      "InvalidationSetsDeduplicated",
+      static_cast<double>(RuleFeatureSet::DeduplicatedInvalidationSetCount() -
+                          orig_deduplicated_invalidation_sets));
+
+  if (selector_stats) {
+    ElementRuleCollector::SetSelectorStatisticsReportForTesting(nullptr);
+    ReportSelectorStatistics(selector_statistics, reporter, label);
+  }
+}
+
+// Measures style and layout for a page with many identical cards which are
+// all size containers with the same set of container queries, while the
+// cards are resized. Unlike the tests above, this does not depend on any
+// external files.
+static void MeasureContainerQueryCardsResize(bool share_results,
+                                             const char* label) {
+  ScopedCSSContainerQueryResultCacheForTest result_cache(share_results);
+
+  constexpr int kNumCards = 1000;
+  constexpr int kNumResizes = 20;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkStyle", label);
+  auto page = std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+  Document& document = page->GetDocument();
+  document.SetCompatibilityMode(Document::kNoQuirksMode);
+
+  StringBuilder html;
+  html.Append(R"HTML(
+    <style>
+      .card { container-type: inline-size; width: 25%; display: inline-block; }
+      .title, .body { color: black; }
+      @container (min-width: 100px) { .title { color: red; } }
+      @container (min-width: 150px) { .body { color: green; } }
+      @container (min-width: 200px) { .title { font-weight: bold; } }
+      @container (min-width: 300px) { .body { display: flex; } }
+      @container (300px < width < 400px) { .title { font-size: 20px; } }
+    </style>
+    <div id="wrapper">
+  )HTML");
+  for (int i = 0; i < kNumCards; ++i) {
+    html.Append(
+        "<div class=card><div class=title>Title</div>"
+        "<div class=body>Body</div></div>");
+  }
+  html.Append("</div>");
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  Element* wrapper = document.getElementById("wrapper");
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumResizes; ++i) {
+    wrapper->setAttribute(
+        html_names::kStyleAttr,
+        AtomicString(String::Format("width: %dpx", 400 + (i % 10) * 100)));
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("ResizeTime", "us");
+  reporter.AddResult("ResizeTime", timer.Elapsed());
+}
+
+TEST(StyleCalcPerfTest, ContainerQueryCardsResize) {
+  MeasureContainerQueryCardsResize(/*share_results=*/false,
+                                   "ContainerQueryCardsResize");
+}
+
+TEST(StyleCalcPerfTest, ContainerQueryCardsResizeSharedResults) {
+  MeasureContainerQueryCardsResize(/*share_results=*/true,
+                                   "ContainerQueryCardsResizeSharedResults");
+}
+
+// Measures style recalc for :has() anchor elements which are restyled for
+// changes which do not affect the :has() argument, in subtree and next sibling
+// traversal shapes similar to check_pseudo_has_cache_scope_context_test.cc.
+static void MeasurePseudoHasAnchorRestyle(bool persistent_cache,
+                                          const char* label) {
+  ScopedCSSPseudoHasPersistentCacheForTest scoped_persistent_cache(
+      persistent_cache);
+
+  constexpr int kNumAnchors = 500;
+  constexpr int kSubtreeDepth = 10;
+  constexpr int kSubtreeWidth = 5;
+  constexpr int kNumRestyles = 20;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkStyle", label);
+  auto page = std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+  Document& document = page->GetDocument();
+  document.SetCompatibilityMode(Document::kNoQuirksMode);
+
+  StringBuilder html;
+  html.Append(R"HTML(
+    <style>
+      .a:has(.b) { color: green; }
+      .a:has(~ .c) { font-weight: bold; }
+      .a.toggle { background-color: blue; }
+    </style>
+    <div id="wrapper">
+  )HTML");
+  for (int i = 0; i < kNumAnchors; ++i) {
+    html.Append("<div class=a>");
+    for (int depth = 0; depth < kSubtreeDepth; ++depth) {
+      for (int j = 1; j < kSubtreeWidth; ++j)
+        html.Append("<div></div>");
+      html.Append("<div>");
+    }
+    // Every tenth anchor element matches ':has(.b)'.
+    if (i % 10 == 0)
+      html.Append("<div class=b></div>");
+    for (int depth = 0; depth < kSubtreeDepth; ++depth)
+      html.Append("</div>");
+    html.Append("</div>");
+  }
+  html.Append("<div class=c></div></div>");
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  StaticElementList* anchors = document.QuerySelectorAll(".a");
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumRestyles; ++i) {
+    for (unsigned j = 0; j < anchors->length(); ++j) {
+      anchors->item(j)->setAttribute(html_names::kClassAttr,
+                                     i % 2 ? "a" : "a toggle");
+    }
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("RestyleTime", "us");
+  reporter.AddResult("RestyleTime", timer.Elapsed());
+}
+
+TEST(StyleCalcPerfTest, PseudoHasAnchorRestyle) {
+  MeasurePseudoHasAnchorRestyle(/*persistent_cache=*/false,
+                                "PseudoHasAnchorRestyle");
+}
+
+TEST(StyleCalcPerfTest, PseudoHasAnchorRestylePersistentCache) {
+  MeasurePseudoHasAnchorRestyle(/*persistent_cache=*/true,
+                                "PseudoHasAnchorRestylePersistentCache");
+}
+
+// Measures the animation style recalcs of many elements animating a custom
+// property with a large set of matching rules, where only the interpolated
+// values change between frames.
+static void MeasureCustomPropertyAnimationFrames(bool reuse_base_style,
+                                                 const char* label) {
+  ScopedCSSAnimationBaseStyleForCustomPropertiesForTest scoped_base_style(
+      reuse_base_style);
+
+  constexpr int kNumElements = 500;
+  constexpr int kNumRules = 100;
+  constexpr int kNumFrames = 20;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkStyle", label);
+  auto page = std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+  Document& document = page->GetDocument();
+  document.SetCompatibilityMode(Document::kNoQuirksMode);
+
+  StringBuilder html;
+  html.Append(R"HTML(
+    <style>
+      @keyframes anim {
+        from { --progress: 0; }
+        to { --progress: 1; }
+      }
+      .item { animation: anim 1s infinite; }
+  )HTML");
+  for (int i = 0; i < kNumRules; ++i) {
+    html.Append(String::Format(
+        "#wrapper .item:nth-child(%dn) { margin-left: %dpx; }\n", i + 1, i));
+  }
+  html.Append("</style><div id=wrapper>");
+  for (int i = 0; i < kNumElements; ++i)
+    html.Append("<div class=item></div>");
+  html.Append("</div>");
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  StaticElementList* items = document.QuerySelectorAll(".item");
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumFrames; ++i) {
+    for (unsigned j = 0; j < items->length(); ++j)
+      items->item(j)->SetNeedsAnimationStyleRecalc();
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("FrameTime", "us");
+  reporter.AddResult("FrameTime", timer.Elapsed() / kNumFrames);
+}
+
+TEST(StyleCalcPerfTest, CustomPropertyAnimationFrames) {
+  MeasureCustomPropertyAnimationFrames(/*reuse_base_style=*/false,
+                                       "CustomPropertyAnimationFrames");
+}
+
+TEST(StyleCalcPerfTest, CustomPropertyAnimationFramesBaseStyle) {
+  MeasureCustomPropertyAnimationFrames(
+      /*reuse_base_style=*/true, "CustomPropertyAnimationFramesBaseStyle");
 }
 
 TEST(StyleCalcPerfTest, Video) {
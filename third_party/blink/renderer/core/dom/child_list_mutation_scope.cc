@@ -32,7 +32,6 @@
 
 #include "third_party/blink/renderer/core/dom/mutation_observer_interest_group.h"
 #include "third_party/blink/renderer/core/dom/mutation_record.h"
-#include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
 #include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
 
@@ -129,10 +128,8 @@ void ChildListMutationAccumulator::EnqueueMutationRecord() {
   DCHECK(HasObservers());
   DCHECK(!IsEmpty());
 
-  StaticNodeList* added_nodes = StaticNodeList::Adopt(added_nodes_);
-  StaticNodeList* removed_nodes = StaticNodeList::Adopt(removed_nodes_);
   MutationRecord* record = MutationRecord::CreateChildList(
-      target_, added_nodes, removed_nodes, previous_sibling_.Release(),
+      target_, added_nodes_, removed_nodes_, previous_sibling_.Release(),
       next_sibling_.Release());
   observers_->EnqueueMutationRecord(record);
   last_added_ = nullptr;
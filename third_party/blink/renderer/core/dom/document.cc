@@ -134,6 +134,7 @@
 #include "third_party/blink/renderer/core/dom/events/event.h"
 #include "third_party/blink/renderer/core/dom/events/event_dispatch_forbidden_scope.h"
 #include "third_party/blink/renderer/core/dom/events/event_listener.h"
+#include "third_party/blink/renderer/core/dom/events/event_path.h"
 #include "third_party/blink/renderer/core/dom/events/native_event_listener.h"
 #include "third_party/blink/renderer/core/dom/events/scoped_event_queue.h"
 #include "third_party/blink/renderer/core/dom/flat_tree_traversal.h"
@@ -149,6 +150,7 @@
 #include "third_party/blink/renderer/core/dom/node_rare_data.h"
 #include "third_party/blink/renderer/core/dom/node_traversal.h"
 #include "third_party/blink/renderer/core/dom/node_with_index.h"
+#include "third_party/blink/renderer/core/dom/nth_index_cache.h"
 #include "third_party/blink/renderer/core/dom/processing_instruction.h"
 #include "third_party/blink/renderer/core/dom/scripted_animation_controller.h"
 #include "third_party/blink/renderer/core/dom/scripted_idle_task_controller.h"
@@ -8268,6 +8270,18 @@ void Document::InvalidateNodeListCaches(const QualifiedName* attr_name) {
     list->InvalidateCacheForAttribute(attr_name);
 }
 
+EventPathCache& Document::EnsureEventPathCache() {
+  if (!event_path_cache_)
+    event_path_cache_ = MakeGarbageCollected<EventPathCache>();
+  return *event_path_cache_;
+}
+
+OrderedNthIndexCache& Document::EnsureOrderedNthIndexCache() {
+  if (!ordered_nth_index_cache_)
+    ordered_nth_index_cache_ = MakeGarbageCollected<OrderedNthIndexCache>();
+  return *ordered_nth_index_cache_;
+}
+
 void Document::PlatformColorsChanged() {
   if (!IsActive())
     return;
@@ -8381,6 +8395,8 @@ void Document::Trace(Visitor* visitor) const {
   visitor->Trace(did_associate_form_controls_timer_);
   visitor->Trace(user_action_elements_);
   visitor->Trace(svg_extensions_);
+  visitor->Trace(ordered_nth_index_cache_);
+  visitor->Trace(event_path_cache_);
   visitor->Trace(layout_view_);
   visitor->Trace(document_animations_);
   visitor->Trace(timeline_);
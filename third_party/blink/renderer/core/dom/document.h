@@ -159,6 +159,7 @@ class ElementRegistrationOptions;
 class Event;
 class EventFactoryBase;
 class EventListener;
+class EventPathCache;
 template <typename EventType>
 class EventWithHitTestResults;
 class ExceptionState;
@@ -197,6 +198,7 @@ class MediaQueryListListener;
 class MediaQueryMatcher;
 class NodeIterator;
 class NthIndexCache;
+class OrderedNthIndexCache;
 class Page;
 class PendingAnimations;
 class PendingLinkPreload;
@@ -1308,6 +1310,14 @@ class CORE_EXPORT Document : public ContainerNode,
   }
   uint64_t DomTreeVersion() const { return dom_tree_version_; }
 
+  // Incremented when the slot assignment of a shadow tree in the document may
+  // change, which changes event paths without changing the DOM tree version.
+  void IncSlotAssignmentVersion() { ++slot_assignment_version_; }
+  uint64_t SlotAssignmentVersion() const { return slot_assignment_version_; }
+
+  EventPathCache* GetEventPathCache() const { return event_path_cache_.Get(); }
+  EventPathCache& EnsureEventPathCache();
+
   uint64_t StyleVersion() const { return style_version_; }
 
   enum PendingSheetLayout {
@@ -1608,6 +1618,10 @@ class CORE_EXPORT Document : public ContainerNode,
   void PlatformColorsChanged();
 
   NthIndexCache* GetNthIndexCache() const { return nth_index_cache_; }
+  OrderedNthIndexCache* GetOrderedNthIndexCache() const {
+    return ordered_nth_index_cache_.Get();
+  }
+  OrderedNthIndexCache& EnsureOrderedNthIndexCache();
 
   CheckPseudoHasCacheScope* GetCheckPseudoHasCacheScope() const {
     return check_pseudo_has_cache_scope_;
@@ -2229,6 +2243,8 @@ class CORE_EXPORT Document : public ContainerNode,
 
   uint64_t dom_tree_version_;
   static uint64_t global_tree_version_;
+  uint64_t slot_assignment_version_ = 0;
+  Member<EventPathCache> event_path_cache_;
 
   uint64_t style_version_;
 
@@ -2338,6 +2354,7 @@ class CORE_EXPORT Document : public ContainerNode,
   // the cache object's references will be traced by a stack walk.
   GC_PLUGIN_IGNORE("https://crbug.com/461878")
   NthIndexCache* nth_index_cache_ = nullptr;
+  Member<OrderedNthIndexCache> ordered_nth_index_cache_;
 
   // This is an untraced pointer to the cache-scoped object that is first
   // allocated on the stack. It is set upon the first object being allocated
@@ -0,0 +1,388 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Benchmarks for DOM mutations, lookups and event dispatch on large documents.
+// Most of them run once with and once without the runtime feature which
+// optimizes the measured code path.
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_mutation_observer_init.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/dom/events/add_event_listener_options_resolved.h"
+#include "third_party/blink/renderer/core/dom/events/event.h"
+#include "third_party/blink/renderer/core/dom/events/native_event_listener.h"
+#include "third_party/blink/renderer/core/dom/mutation_observer.h"
+#include "third_party/blink/renderer/core/dom/mutation_record.h"
+#include "third_party/blink/renderer/core/dom/shadow_root.h"
+#include "third_party/blink/renderer/core/dom/slot_assignment_engine.h"
+#include "third_party/blink/renderer/core/dom/static_node_list.h"
+#include "third_party/blink/renderer/core/event_type_names.h"
+#include "third_party/blink/renderer/core/frame/local_frame_view.h"
+#include "third_party/blink/renderer/core/html/html_body_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/loader/empty_clients.h"
+#include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
+#include "third_party/blink/renderer/core/testing/no_network_web_url_loader.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+std::unique_ptr<DummyPageHolder> CreatePage() {
+  return std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+}
+
+class EmptyMutationCallback : public MutationObserver::Delegate {
+ public:
+  explicit EmptyMutationCallback(Document& document) : document_(document) {}
+
+  ExecutionContext* GetExecutionContext() const override {
+    return document_->GetExecutionContext();
+  }
+
+  void Deliver(const MutationRecordVector&, MutationObserver&) override {}
+
+  void Trace(Visitor* visitor) const override {
+    visitor->Trace(document_);
+    MutationObserver::Delegate::Trace(visitor);
+  }
+
+ private:
+  Member<Document> document_;
+};
+
+class EmptyEventListener final : public NativeEventListener {
+ public:
+  void Invoke(ExecutionContext*, Event*) override {}
+};
+
+// Returns whether |target| has wheel listeners which are not passive, and
+// thus block scrolling.
+bool HasBlockingWheelListeners(EventTarget& target) {
+  EventListenerVector* listeners =
+      target.GetEventListeners(event_type_names::kWheel);
+  if (!listeners)
+    return false;
+  for (const RegisteredEventListener& listener : *listeners) {
+    if (!listener.Passive())
+      return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+// Dispatches high frequency input events, like pointermove, to a target deep
+// in nested shadow trees, with and without the EventPathCache of the document.
+static void MeasurePointerMoveDispatch(bool use_cache, const char* label) {
+  ScopedEventPathCacheForTest event_path_cache(use_cache);
+
+  constexpr int kShadowDepth = 30;
+  constexpr int kNumEvents = 1000000;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkEvents", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  // Each shadow tree slots the host of the next one, like nested components
+  // which project their content.
+  Element* host = document.CreateRawElement(html_names::kDivTag);
+  document.body()->AppendChild(host);
+  for (int i = 0; i < kShadowDepth; ++i) {
+    ShadowRoot& shadow_root =
+        host->AttachShadowRootInternal(ShadowRootType::kOpen);
+    shadow_root.setInnerHTML("<div><span><slot></slot></span></div>",
+                             ASSERT_NO_EXCEPTION);
+    Element* child = document.CreateRawElement(html_names::kDivTag);
+    host->AppendChild(child);
+    host = child;
+  }
+  Persistent<Element> target = host;
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumEvents; ++i) {
+    target->DispatchEvent(*MakeGarbageCollected<Event>(
+        event_type_names::kPointermove, Event::Bubbles::kYes,
+        Event::Cancelable::kYes, Event::ComposedMode::kComposed));
+  }
+  reporter.RegisterImportantMetric("DispatchTime", "us");
+  reporter.AddResult("DispatchTime", timer.Elapsed());
+}
+
+TEST(DOMPerfTest, PointerMoveInNestedShadowTrees) {
+  MeasurePointerMoveDispatch(/*use_cache=*/false,
+                             "PointerMoveInNestedShadowTrees");
+}
+
+TEST(DOMPerfTest, PointerMoveInNestedShadowTreesCached) {
+  MeasurePointerMoveDispatch(/*use_cache=*/true,
+                             "PointerMoveInNestedShadowTreesCached");
+}
+
+// Inserts and removes many children one by one under a subtree which is
+// observed for childList mutations, with and without coalescing of the
+// mutation records.
+static void MeasureBulkChildListMutations(bool coalesce, const char* label) {
+  ScopedCoalescedMutationRecordsForTest coalesced_mutation_records(coalesce);
+
+  constexpr int kNumChildren = 10000;
+  constexpr int kNumIterations = 20;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkDOM", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  Persistent<MutationObserver> observer = MutationObserver::Create(
+      MakeGarbageCollected<EmptyMutationCallback>(document));
+  MutationObserverInit* init = MutationObserverInit::Create();
+  init->setChildList(true);
+  init->setSubtree(true);
+  observer->observe(document.body(), init, ASSERT_NO_EXCEPTION);
+
+  Persistent<Element> container =
+      document.CreateRawElement(html_names::kDivTag);
+  document.body()->AppendChild(container);
+  observer->takeRecords();
+
+  base::ElapsedTimer timer;
+  wtf_size_t record_count = 0;
+  wtf_size_t node_count = 0;
+  for (int i = 0; i < kNumIterations; ++i) {
+    for (int j = 0; j < kNumChildren; ++j)
+      container->AppendChild(document.CreateRawElement(html_names::kDivTag));
+    while (Node* child = container->firstChild())
+      container->RemoveChild(child);
+    MutationRecordVector records = observer->takeRecords();
+    record_count += records.size();
+    for (MutationRecord* record : records) {
+      node_count +=
+          record->addedNodes()->length() + record->removedNodes()->length();
+    }
+  }
+  CHECK_EQ(static_cast<wtf_size_t>(2 * kNumChildren * kNumIterations),
+           node_count);
+  reporter.RegisterImportantMetric("MutationTime", "us");
+  reporter.AddResult("MutationTime", timer.Elapsed());
+  reporter.RegisterImportantMetric("RecordCount", "records");
+  reporter.AddResult("RecordCount", static_cast<size_t>(record_count));
+}
+
+TEST(DOMPerfTest, BulkChildListMutations) {
+  MeasureBulkChildListMutations(/*coalesce=*/false, "BulkChildListMutations");
+}
+
+TEST(DOMPerfTest, BulkChildListMutationsCoalesced) {
+  MeasureBulkChildListMutations(/*coalesce=*/true,
+                                "BulkChildListMutationsCoalesced");
+}
+
+// Recalculates the slot assignment of many custom elements with shadow roots,
+// when most of the recalcs don't change the assignment, with and without
+// skipping those.
+static void MeasureSlotAssignmentRecalc(bool skip_unchanged,
+                                        const char* label) {
+  ScopedSkipUnchangedSlotAssignmentRecalcForTest skip_unchanged_recalc(
+      skip_unchanged);
+
+  constexpr int kNumCustomElements = 5000;
+  constexpr int kNumIterations = 50;
+  // One in kChangeInterval custom elements gets a child which is slotted.
+  constexpr int kChangeInterval = 50;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkDOM", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  StringBuilder html;
+  for (int i = 0; i < kNumCustomElements; ++i) {
+    html.Append(
+        "<my-element><span slot=title>Title</span><span>Content</span>"
+        "</my-element>");
+  }
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  HeapVector<Member<Element>> hosts;
+  for (Element* host = document.body()->firstElementChild(); host;
+       host = host->nextElementSibling()) {
+    ShadowRoot& shadow_root =
+        host->AttachShadowRootInternal(ShadowRootType::kOpen);
+    shadow_root.setInnerHTML(
+        "<header><slot name=title></slot></header><slot></slot>",
+        ASSERT_NO_EXCEPTION);
+    hosts.push_back(host);
+  }
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  SlotAssignmentEngine& engine = document.GetSlotAssignmentEngine();
+  base::TimeDelta recalc_time;
+  for (int i = 0; i < kNumIterations; ++i) {
+    // Every host gets a new child, which is only slotted for some of them,
+    // then loses it again.
+    HeapVector<Member<Element>> children;
+    for (int j = 0; j < kNumCustomElements; ++j) {
+      Element* child = document.CreateRawElement(html_names::kSpanTag);
+      if (j % kChangeInterval)
+        child->setAttribute(html_names::kSlotAttr, "unused");
+      hosts[j]->AppendChild(child);
+      children.push_back(child);
+    }
+    base::ElapsedTimer timer;
+    engine.RecalcSlotAssignments();
+    recalc_time += timer.Elapsed();
+
+    for (Element* child : children)
+      child->remove();
+    timer = base::ElapsedTimer();
+    engine.RecalcSlotAssignments();
+    recalc_time += timer.Elapsed();
+  }
+  reporter.RegisterImportantMetric("RecalcTime", "us");
+  reporter.AddResult("RecalcTime", recalc_time);
+}
+
+TEST(DOMPerfTest, SlotAssignmentRecalcMostlyUnchanged) {
+  MeasureSlotAssignmentRecalc(/*skip_unchanged=*/false,
+                              "SlotAssignmentRecalcMostlyUnchanged");
+}
+
+TEST(DOMPerfTest, SlotAssignmentRecalcMostlyUnchangedSkipped) {
+  MeasureSlotAssignmentRecalc(/*skip_unchanged=*/true,
+                              "SlotAssignmentRecalcMostlyUnchangedSkipped");
+}
+
+// The listener lookups done for every element of the scroll chain during
+// scrolling: whether there are wheel, touch or scroll listeners, and whether
+// those are passive. Measured with and without the type filter of
+// EventListenerMap.
+static void MeasureScrollListenerLookups(bool type_filter, const char* label) {
+  ScopedEventListenerMapTypeFilterForTest event_listener_map_type_filter(
+      type_filter);
+
+  constexpr int kNumElements = 1000;
+  constexpr int kNumScrollUpdates = 10000;
+
+  auto reporter =
+      perf_test::PerfResultReporter("BlinkEvents", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  // Elements of an app usually have listeners for a few input event types
+  // which are not related to scrolling. Some have passive or non-passive
+  // wheel listeners.
+  EventListener* listener = MakeGarbageCollected<EmptyEventListener>();
+  const AtomicString* other_types[] = {
+      &event_type_names::kClick,     &event_type_names::kMousedown,
+      &event_type_names::kMouseup,   &event_type_names::kKeydown,
+      &event_type_names::kFocus,     &event_type_names::kBlur,
+  };
+  HeapVector<Member<Element>> elements;
+  for (int i = 0; i < kNumElements; ++i) {
+    Element* element = document.CreateRawElement(html_names::kDivTag);
+    for (const AtomicString* type : other_types)
+      element->addEventListener(*type, listener);
+    if (i % 10 == 0) {
+      auto* options = MakeGarbageCollected<AddEventListenerOptionsResolved>();
+      options->setPassive(i % 20 == 0);
+      element->addEventListener(event_type_names::kWheel, listener, options);
+    }
+    elements.push_back(element);
+  }
+
+  base::ElapsedTimer timer;
+  unsigned blocking_count = 0;
+  for (int i = 0; i < kNumScrollUpdates; ++i) {
+    for (Element* element : elements) {
+      if (HasBlockingWheelListeners(*element))
+        ++blocking_count;
+      if (element->HasEventListeners(event_type_names::kTouchstart) ||
+          element->HasEventListeners(event_type_names::kTouchmove) ||
+          element->HasEventListeners(event_type_names::kScroll)) {
+        ++blocking_count;
+      }
+    }
+  }
+  CHECK_EQ(static_cast<unsigned>(kNumScrollUpdates * kNumElements / 20),
+           blocking_count);
+  reporter.RegisterImportantMetric("LookupTime", "us");
+  reporter.AddResult("LookupTime", timer.Elapsed());
+}
+
+TEST(DOMPerfTest, ScrollListenerLookups) {
+  MeasureScrollListenerLookups(/*type_filter=*/false, "ScrollListenerLookups");
+}
+
+TEST(DOMPerfTest, ScrollListenerLookupsWithTypeFilter) {
+  MeasureScrollListenerLookups(/*type_filter=*/true,
+                               "ScrollListenerLookupsWithTypeFilter");
+}
+
+// getElementById() on a document where thousands of list items share the same
+// ids, while the items are moved around, with and without
+// IncrementalTreeOrderedMap.
+static void MeasureDuplicateIdLookups(bool incremental, const char* label) {
+  ScopedIncrementalTreeOrderedMapForTest incremental_tree_ordered_map(
+      incremental);
+
+  // The number of elements before the list, which the tree walks of
+  // TreeOrderedMap go over.
+  constexpr int kNumPrecedingElements = 20000;
+  constexpr int kNumItems = 5000;
+  constexpr int kNumMutations = 2000;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkDOM", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  // Every item of the list was stamped from the same template.
+  StringBuilder html;
+  html.Append("<main>");
+  for (int i = 0; i < kNumPrecedingElements; ++i)
+    html.Append("<p></p>");
+  html.Append("</main><ul>");
+  for (int i = 0; i < kNumItems; ++i) {
+    html.Append(
+        "<li><div><span id=title>Title</span><button id=remove>x</button>"
+        "</div></li>");
+  }
+  html.Append("</ul>");
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  Persistent<Element> list = document.body()->lastElementChild();
+
+  const AtomicString title("title");
+  const AtomicString remove("remove");
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumMutations; ++i) {
+    // Move an item from the start of the list to the end, or the other way
+    // around, which changes the first element with each id.
+    if (i % 2) {
+      list->insertBefore(list->lastElementChild(), list->firstElementChild());
+    } else {
+      list->AppendChild(list->firstElementChild());
+    }
+    CHECK(document.getElementById(title));
+    CHECK(document.getElementById(remove));
+  }
+  reporter.RegisterImportantMetric("LookupTime", "us");
+  reporter.AddResult("LookupTime", timer.Elapsed());
+}
+
+TEST(DOMPerfTest, DuplicateIdLookups) {
+  MeasureDuplicateIdLookups(/*incremental=*/false, "DuplicateIdLookups");
+}
+
+TEST(DOMPerfTest, DuplicateIdLookupsIncremental) {
+  MeasureDuplicateIdLookups(/*incremental=*/true,
+                            "DuplicateIdLookupsIncremental");
+}
+
+}  // namespace blink
@@ -3314,16 +3314,25 @@ void Element::StripScriptingAttributes(
 
 void Element::ParserSetAttributes(
     const Vector<Attribute, kAttributePrealloc>& attribute_vector) {
+  unsigned attribute_hash = 0;
+  if (!attribute_vector.IsEmpty() && GetDocument().GetElementDataCache())
+    attribute_hash = ElementDataCache::AttributeHash(attribute_vector);
+  ParserSetAttributes(attribute_vector, attribute_hash);
+}
+
+void Element::ParserSetAttributes(
+    const Vector<Attribute, kAttributePrealloc>& attribute_vector,
+    unsigned attribute_hash) {
   DCHECK(!isConnected());
   DCHECK(!parentNode());
   DCHECK(!element_data_);
 
   if (!attribute_vector.IsEmpty()) {
     if (GetDocument().GetElementDataCache())
-      element_data_ =
-          GetDocument()
-              .GetElementDataCache()
-              ->CachedShareableElementDataWithAttributes(attribute_vector);
+      element_data_ = GetDocument()
+                          .GetElementDataCache()
+                          ->CachedShareableElementDataWithAttributes(
+                              attribute_vector, attribute_hash);
     else
       element_data_ =
           ShareableElementData::CreateWithAttributes(attribute_vector);
@@ -3540,6 +3549,8 @@ void Element::RemovedFrom(ContainerNode& insertion_point) {
     if (this == GetDocument().CssTarget())
       GetDocument().SetCSSTarget(nullptr);
 
+    GetDocument().GetStyleEngine().ElementRemovedForPseudoHas(*this);
+
     if (GetCustomElementState() == CustomElementState::kCustom)
       CustomElement::EnqueueDisconnectedCallback(*this);
   }
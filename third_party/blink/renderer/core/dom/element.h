@@ -625,6 +625,10 @@ class CORE_EXPORT Element : public ContainerNode, public Animatable {
 
   // Only called by the parser immediately after element construction.
   void ParserSetAttributes(const Vector<Attribute, kAttributePrealloc>&);
+  // Same as above, with the ElementDataCache::AttributeHash() of the
+  // attributes computed by the parser.
+  void ParserSetAttributes(const Vector<Attribute, kAttributePrealloc>&,
+                           unsigned attribute_hash);
 
   // Remove attributes that might introduce scripting from the vector leaving
   // the element unchanged.
@@ -27,13 +27,40 @@
 #include "third_party/blink/renderer/core/dom/element_data_cache.h"
 
 #include "third_party/blink/renderer/core/dom/element_data.h"
+#include "third_party/blink/renderer/platform/wtf/hash_functions.h"
+#include "third_party/blink/renderer/platform/wtf/hash_traits.h"
 
 namespace blink {
 
-inline unsigned AttributeHash(
+namespace {
+
+inline unsigned StringContentHash(const String& string) {
+  // Atomized strings always have their hash computed already.
+  return string.IsNull() ? 0 : string.Impl()->GetHash();
+}
+
+}  // namespace
+
+void ElementDataCache::AttributeHasher::Add(const String& prefix,
+                                            const String& local_name,
+                                            const String& namespace_uri,
+                                            const String& value) {
+  unsigned name_hash =
+      WTF::HashInts(WTF::HashInts(StringContentHash(prefix),
+                                  StringContentHash(local_name)),
+                    StringContentHash(namespace_uri));
+  hash_ = WTF::HashInts(hash_,
+                        WTF::HashInts(name_hash, StringContentHash(value)));
+}
+
+unsigned ElementDataCache::AttributeHash(
     const Vector<Attribute, kAttributePrealloc>& attributes) {
-  return StringHasher::HashMemory(attributes.data(),
-                                  attributes.size() * sizeof(Attribute));
+  AttributeHasher hasher;
+  for (const Attribute& attribute : attributes) {
+    hasher.Add(attribute.Prefix(), attribute.LocalName(),
+               attribute.NamespaceURI(), attribute.Value());
+  }
+  return hasher.GetHash();
 }
 
 inline bool HasSameAttributes(
@@ -48,10 +75,24 @@ inline bool HasSameAttributes(
 ShareableElementData*
 ElementDataCache::CachedShareableElementDataWithAttributes(
     const Vector<Attribute, kAttributePrealloc>& attributes) {
+  return CachedShareableElementDataWithAttributes(attributes,
+                                                  AttributeHash(attributes));
+}
+
+ShareableElementData*
+ElementDataCache::CachedShareableElementDataWithAttributes(
+    const Vector<Attribute, kAttributePrealloc>& attributes,
+    unsigned attribute_hash) {
   DCHECK(!attributes.IsEmpty());
 
+  // The empty and deleted values of the hash table can't be used as keys.
+  if (WTF::IsHashTraitsEmptyOrDeletedValue<HashTraits<unsigned>>(
+          attribute_hash)) {
+    return ShareableElementData::CreateWithAttributes(attributes);
+  }
+
   ShareableElementDataCache::ValueType* it =
-      shareable_element_data_cache_.insert(AttributeHash(attributes), nullptr)
+      shareable_element_data_cache_.insert(attribute_hash, nullptr)
           .stored_value;
 
   // FIXME: This prevents sharing when there's a hash collision.
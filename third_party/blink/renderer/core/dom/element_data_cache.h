@@ -27,9 +27,11 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_DOM_ELEMENT_DATA_CACHE_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_DOM_ELEMENT_DATA_CACHE_H_
 
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/dom/attribute.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 
@@ -37,12 +39,40 @@ namespace blink {
 
 class ShareableElementData;
 
-class ElementDataCache final : public GarbageCollected<ElementDataCache> {
+class CORE_EXPORT ElementDataCache final
+    : public GarbageCollected<ElementDataCache> {
  public:
+  // Computes the cache key of an attribute vector from the qualified names
+  // (prefix, local name and namespace) and values of the attributes. The hash only depends on the string contents,
+  // so the HTML parser can compute it for a token before the names and values
+  // are atomized on the main thread. A hash computed from different strings
+  // than the final attributes only prevents sharing, since entries are always
+  // compared attribute by attribute.
+  class CORE_EXPORT AttributeHasher {
+    STACK_ALLOCATED();
+
+   public:
+    void Add(const String& prefix,
+             const String& local_name,
+             const String& namespace_uri,
+             const String& value);
+    unsigned GetHash() const { return hash_; }
+
+   private:
+    unsigned hash_ = 0;
+  };
+
   ElementDataCache();
 
+  static unsigned AttributeHash(const Vector<Attribute, kAttributePrealloc>&);
+
   ShareableElementData* CachedShareableElementDataWithAttributes(
       const Vector<Attribute, kAttributePrealloc>&);
+  // Same as above, with the AttributeHash() of the attributes computed up
+  // front, e.g. by the parser.
+  ShareableElementData* CachedShareableElementDataWithAttributes(
+      const Vector<Attribute, kAttributePrealloc>&,
+      unsigned attribute_hash);
 
   void Trace(Visitor*) const;
 
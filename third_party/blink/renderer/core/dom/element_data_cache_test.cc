@@ -0,0 +1,91 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/dom/element_data_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/dom/element_data.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/xlink_names.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+
+namespace blink {
+
+namespace {
+
+Vector<Attribute, kAttributePrealloc> MakeAttributes(const char* id,
+                                                     const char* classes) {
+  Vector<Attribute, kAttributePrealloc> attributes;
+  attributes.push_back(Attribute(html_names::kIdAttr, AtomicString(id)));
+  attributes.push_back(
+      Attribute(html_names::kClassAttr, AtomicString(classes)));
+  return attributes;
+}
+
+}  // namespace
+
+TEST(ElementDataCacheTest, AttributeHashFromStrings) {
+  Vector<Attribute, kAttributePrealloc> attributes =
+      MakeAttributes("target", "a b c");
+
+  // The parser computes the hash from strings which are not atomized yet.
+  ElementDataCache::AttributeHasher hasher;
+  hasher.Add(String(), String("id"), String(), String("target"));
+  hasher.Add(String(), String("class"), String(), String("a b c"));
+  EXPECT_EQ(ElementDataCache::AttributeHash(attributes), hasher.GetHash());
+
+  ElementDataCache::AttributeHasher other_hasher;
+  other_hasher.Add(String(), String("id"), String(), String("target"));
+  other_hasher.Add(String(), String("class"), String(), String("a b"));
+  EXPECT_NE(ElementDataCache::AttributeHash(attributes),
+            other_hasher.GetHash());
+}
+
+TEST(ElementDataCacheTest, AttributeHashIncludesNamespace) {
+  Vector<Attribute, kAttributePrealloc> attributes;
+  attributes.push_back(Attribute(html_names::kHrefAttr, AtomicString("#a")));
+  Vector<Attribute, kAttributePrealloc> xlink_attributes;
+  xlink_attributes.push_back(
+      Attribute(xlink_names::kHrefAttr, AtomicString("#a")));
+  EXPECT_NE(ElementDataCache::AttributeHash(attributes),
+            ElementDataCache::AttributeHash(xlink_attributes));
+
+  ElementDataCache::AttributeHasher hasher;
+  hasher.Add(String("xlink"), String("href"),
+             String("http://www.w3.org/1999/xlink"), String("#a"));
+  EXPECT_EQ(ElementDataCache::AttributeHash(xlink_attributes),
+            hasher.GetHash());
+}
+
+TEST(ElementDataCacheTest, SharesElementData) {
+  Persistent<ElementDataCache> cache =
+      MakeGarbageCollected<ElementDataCache>();
+
+  Vector<Attribute, kAttributePrealloc> attributes =
+      MakeAttributes("target", "a b c");
+  ShareableElementData* data =
+      cache->CachedShareableElementDataWithAttributes(attributes);
+  ASSERT_TRUE(data);
+  EXPECT_EQ(data, cache->CachedShareableElementDataWithAttributes(
+                      MakeAttributes("target", "a b c")));
+  EXPECT_EQ(data, cache->CachedShareableElementDataWithAttributes(
+                      attributes, ElementDataCache::AttributeHash(attributes)));
+  EXPECT_NE(data, cache->CachedShareableElementDataWithAttributes(
+                      MakeAttributes("target", "a b")));
+
+  // A hash which does not match the attributes only prevents sharing.
+  ShareableElementData* unshared =
+      cache->CachedShareableElementDataWithAttributes(
+          attributes, ElementDataCache::AttributeHash(attributes) + 1);
+  EXPECT_NE(data, unshared);
+  EXPECT_EQ(2u, unshared->Attributes().size());
+
+  // The empty value of the hash table is never used as a key.
+  unshared = cache->CachedShareableElementDataWithAttributes(attributes, 0);
+  EXPECT_NE(data, unshared);
+  EXPECT_EQ(2u, unshared->Attributes().size());
+}
+
+}  // namespace blink
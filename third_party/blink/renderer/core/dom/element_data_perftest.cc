@@ -0,0 +1,127 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Benchmarks for the main thread work of the parser to set up the attributes
+// and class lists of elements on class-heavy markup, such as pages using
+// utility-first CSS frameworks with 20+ classes per element. Compares the
+// default path to the one where the parser pre-hashes the attribute vectors
+// before handing them to the main thread.
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element_data_cache.h"
+#include "third_party/blink/renderer/core/frame/local_frame_view.h"
+#include "third_party/blink/renderer/core/html/html_body_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/loader/empty_clients.h"
+#include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
+#include "third_party/blink/renderer/core/testing/no_network_web_url_loader.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+constexpr int kNumElements = 5000;
+constexpr int kMinClassesPerElement = 20;
+constexpr int kNumUtilityClasses = 300;
+constexpr int kNumIterations = 10;
+
+// Returns a class attribute value of 20+ utility classes, like
+// "p-4 text-sm md:flex ...". Every third element repeats the class list of
+// another element, as components are usually repeated on a page.
+String ClassListForElement(int index) {
+  if (index % 3 == 2)
+    index = index / 3;
+  StringBuilder builder;
+  int num_classes = kMinClassesPerElement + index % 8;
+  for (int i = 0; i < num_classes; ++i) {
+    if (i)
+      builder.Append(' ');
+    int utility = (index * 7 + i * 13) % kNumUtilityClasses;
+    if (utility % 4 == 0)
+      builder.Append("md:");
+    builder.Append(String::Format("u-%d-%d", utility / 10, utility % 10));
+  }
+  return builder.ToString();
+}
+
+}  // namespace
+
+TEST(ElementDataPerfTest, ParseClassHeavyMarkup) {
+  auto reporter =
+      perf_test::PerfResultReporter("BlinkParser", "ClassHeavyMarkup");
+  auto page = std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+  Document& document = page->GetDocument();
+
+  StringBuilder html;
+  for (int i = 0; i < kNumElements; ++i) {
+    html.Append("<div class=\"");
+    html.Append(ClassListForElement(i));
+    html.Append("\" data-index=x></div>");
+  }
+  String markup = html.ToString();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumIterations; ++i)
+    document.body()->setInnerHTML(markup, ASSERT_NO_EXCEPTION);
+  reporter.RegisterImportantMetric("ParseTime", "us");
+  reporter.AddResult("ParseTime", timer.Elapsed() / kNumIterations);
+}
+
+TEST(ElementDataPerfTest, CacheAttributeVectors) {
+  auto reporter =
+      perf_test::PerfResultReporter("BlinkParser", "AttributeVectors");
+
+  Vector<Vector<Attribute, kAttributePrealloc>> attribute_vectors;
+  for (int i = 0; i < kNumElements; ++i) {
+    Vector<Attribute, kAttributePrealloc> attributes;
+    attributes.push_back(Attribute(html_names::kClassAttr,
+                                   AtomicString(ClassListForElement(i))));
+    attributes.push_back(
+        Attribute(html_names::kIdAttr, AtomicString::Number(i % 100)));
+    attribute_vectors.push_back(std::move(attributes));
+  }
+
+  // The work the parser would do off the main thread. The hashes of the
+  // strings are not cached yet there, unlike for the atomized strings here,
+  // so this is a lower bound.
+  base::ElapsedTimer pre_hash_timer;
+  Vector<unsigned> attribute_hashes;
+  for (const auto& attributes : attribute_vectors)
+    attribute_hashes.push_back(ElementDataCache::AttributeHash(attributes));
+  reporter.RegisterFyiMetric("PreHashTime", "us");
+  reporter.AddResult("PreHashTime", pre_hash_timer.Elapsed());
+
+  base::ElapsedTimer hash_timer;
+  for (int i = 0; i < kNumIterations; ++i) {
+    Persistent<ElementDataCache> cache =
+        MakeGarbageCollected<ElementDataCache>();
+    for (const auto& attributes : attribute_vectors)
+      cache->CachedShareableElementDataWithAttributes(attributes);
+  }
+  reporter.RegisterImportantMetric("LookupTime", "us");
+  reporter.AddResult("LookupTime", hash_timer.Elapsed() / kNumIterations);
+
+  base::ElapsedTimer pre_hashed_timer;
+  for (int i = 0; i < kNumIterations; ++i) {
+    Persistent<ElementDataCache> cache =
+        MakeGarbageCollected<ElementDataCache>();
+    for (wtf_size_t j = 0; j < attribute_vectors.size(); ++j) {
+      cache->CachedShareableElementDataWithAttributes(attribute_vectors[j],
+                                                      attribute_hashes[j]);
+    }
+  }
+  reporter.RegisterImportantMetric("PreHashedLookupTime", "us");
+  reporter.AddResult("PreHashedLookupTime",
+                     pre_hashed_timer.Elapsed() / kNumIterations);
+}
+
+}  // namespace blink
@@ -36,6 +36,7 @@
 #include "third_party/blink/renderer/core/dom/events/add_event_listener_options_resolved.h"
 #include "third_party/blink/renderer/core/dom/events/event_listener.h"
 #include "third_party/blink/renderer/core/dom/events/event_target.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 
@@ -60,7 +61,14 @@ void EventListenerMap::CheckNoActiveIterators() {
 
 EventListenerMap::EventListenerMap() = default;
 
+inline bool EventListenerMap::MayContain(const AtomicString& event_type) const {
+  return !RuntimeEnabledFeatures::EventListenerMapTypeFilterEnabled() ||
+         (type_filter_ & TypeFilterBit(event_type));
+}
+
 bool EventListenerMap::Contains(const AtomicString& event_type) const {
+  if (!MayContain(event_type))
+    return false;
   for (const auto& entry : entries_) {
     if (entry.first == event_type)
       return true;
@@ -69,6 +77,8 @@ bool EventListenerMap::Contains(const AtomicString& event_type) const {
 }
 
 bool EventListenerMap::ContainsCapturing(const AtomicString& event_type) const {
+  if (!MayContain(event_type))
+    return false;
   for (const auto& entry : entries_) {
     if (entry.first == event_type) {
       for (const auto& event_listener : *entry.second) {
@@ -83,6 +93,8 @@ bool EventListenerMap::ContainsCapturing(const AtomicString& event_type) const {
 
 bool EventListenerMap::ContainsJSBasedEventListeners(
     const AtomicString& event_type) const {
+  if (!MayContain(event_type))
+    return false;
   for (const auto& entry : entries_) {
     if (entry.first == event_type) {
       for (const auto& event_listener : *entry.second) {
@@ -100,6 +112,7 @@ void EventListenerMap::Clear() {
   CheckNoActiveIterators();
 
   entries_.clear();
+  type_filter_ = 0;
 }
 
 Vector<AtomicString> EventListenerMap::EventTypes() const {
@@ -131,12 +144,16 @@ bool EventListenerMap::Add(const AtomicString& event_type,
                            RegisteredEventListener* registered_listener) {
   CheckNoActiveIterators();
 
-  for (const auto& entry : entries_) {
-    if (entry.first == event_type)
-      return AddListenerToVector(entry.second.Get(), listener, options,
-                                 registered_listener);
+  if (MayContain(event_type)) {
+    for (const auto& entry : entries_) {
+      if (entry.first == event_type)
+        return AddListenerToVector(entry.second.Get(), listener, options,
+                                   registered_listener);
+    }
   }
 
+  if (RuntimeEnabledFeatures::EventListenerMapTypeFilterEnabled())
+    type_filter_ |= TypeFilterBit(event_type);
   entries_.push_back(
       std::make_pair(event_type, MakeGarbageCollected<EventListenerVector>()));
   return AddListenerToVector(entries_.back().second.Get(), listener, options,
@@ -177,13 +194,17 @@ bool EventListenerMap::Remove(const AtomicString& event_type,
                               RegisteredEventListener* registered_listener) {
   CheckNoActiveIterators();
 
+  if (!MayContain(event_type))
+    return false;
   for (unsigned i = 0; i < entries_.size(); ++i) {
     if (entries_[i].first == event_type) {
       bool was_removed = RemoveListenerFromVector(
           entries_[i].second.Get(), listener, options,
           index_of_removed_listener, registered_listener);
-      if (entries_[i].second->IsEmpty())
+      if (entries_[i].second->IsEmpty()) {
         entries_.EraseAt(i);
+        RebuildTypeFilter();
+      }
       return was_removed;
     }
   }
@@ -194,6 +215,8 @@ bool EventListenerMap::Remove(const AtomicString& event_type,
 EventListenerVector* EventListenerMap::Find(const AtomicString& event_type) {
   CheckNoActiveIterators();
 
+  if (!MayContain(event_type))
+    return nullptr;
   for (const auto& entry : entries_) {
     if (entry.first == event_type)
       return entry.second.Get();
@@ -202,6 +225,15 @@ EventListenerVector* EventListenerMap::Find(const AtomicString& event_type) {
   return nullptr;
 }
 
+void EventListenerMap::RebuildTypeFilter() {
+  if (!RuntimeEnabledFeatures::EventListenerMapTypeFilterEnabled())
+    return;
+  // Other types may share the bit of the removed type.
+  type_filter_ = 0;
+  for (const auto& entry : entries_)
+    type_filter_ |= TypeFilterBit(entry.first);
+}
+
 static void CopyListenersNotCreatedFromMarkupToTarget(
     const AtomicString& event_type,
     EventListenerVector* listener_vector,
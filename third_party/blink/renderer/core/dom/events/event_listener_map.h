@@ -82,11 +82,23 @@ class CORE_EXPORT EventListenerMap final {
 
   void CheckNoActiveIterators();
 
+  // One bit of |type_filter_| per event type, picked by the hash of the type.
+  static uint64_t TypeFilterBit(const AtomicString& event_type) {
+    return uint64_t{1} << (event_type.Impl()->ExistingHash() & 63);
+  }
+  // Always true when the EventListenerMapTypeFilter feature is disabled.
+  bool MayContain(const AtomicString& event_type) const;
+  void RebuildTypeFilter();
+
   // We use HeapVector instead of HeapHashMap because
   //  - HeapVector is much more space efficient than HeapHashMap.
   //  - An EventTarget rarely has event listeners for many event types, and
   //    HeapVector is faster in such cases.
   HeapVector<std::pair<AtomicString, Member<EventListenerVector>>, 2> entries_;
+  // A bloom filter of the event types in |entries_|, so that looking up a
+  // type which has no listeners, like on most targets of the scroll, wheel,
+  // touch and pointer events, does not compare against every entry.
+  uint64_t type_filter_ = 0;
 
 #if DCHECK_IS_ON()
   int active_iterator_count_ = 0;
@@ -0,0 +1,110 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/dom/events/event_listener_map.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/dom/events/native_event_listener.h"
+#include "third_party/blink/renderer/core/event_type_names.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/testing/page_test_base.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+
+namespace blink {
+
+namespace {
+
+class EmptyEventListener final : public NativeEventListener {
+ public:
+  void Invoke(ExecutionContext*, Event*) override {}
+};
+
+// More types than there are bits in the type filter, so that some of them
+// share a bit.
+constexpr int kNumTypes = 200;
+
+AtomicString TypeName(int i) {
+  return AtomicString(String::Format("custom%d", i));
+}
+
+}  // namespace
+
+// Runs the tests with and without the type filter.
+class EventListenerMapTest : public testing::WithParamInterface<bool>,
+                             private ScopedEventListenerMapTypeFilterForTest,
+                             public PageTestBase {
+ public:
+  EventListenerMapTest()
+      : ScopedEventListenerMapTypeFilterForTest(GetParam()) {}
+};
+
+INSTANTIATE_TEST_SUITE_P(All, EventListenerMapTest, testing::Bool());
+
+TEST_P(EventListenerMapTest, AddRemoveChurn) {
+  Persistent<Element> target =
+      GetDocument().CreateRawElement(html_names::kDivTag);
+  Persistent<EventListener> listener =
+      MakeGarbageCollected<EmptyEventListener>();
+  Persistent<EventListener> other_listener =
+      MakeGarbageCollected<EmptyEventListener>();
+
+  for (int i = 0; i < kNumTypes; ++i) {
+    target->addEventListener(TypeName(i), listener);
+    if (i % 2)
+      target->addEventListener(TypeName(i), other_listener);
+  }
+  for (int i = 0; i < kNumTypes; ++i)
+    EXPECT_TRUE(target->HasEventListeners(TypeName(i))) << i;
+  EXPECT_FALSE(target->HasEventListeners(event_type_names::kWheel));
+  EXPECT_FALSE(target->HasEventListeners(event_type_names::kTouchstart));
+
+  // Remove one listener of every type. Only the types with a second listener
+  // are left.
+  for (int i = 0; i < kNumTypes; ++i)
+    target->removeEventListener(TypeName(i), listener, /*use_capture=*/false);
+  for (int i = 0; i < kNumTypes; ++i)
+    EXPECT_EQ(i % 2 == 1, target->HasEventListeners(TypeName(i))) << i;
+
+  // Add and remove types again, in a different order.
+  for (int i = kNumTypes - 1; i >= 0; i -= 3)
+    target->addEventListener(TypeName(i), listener);
+  for (int i = 0; i < kNumTypes; i += 5)
+    target->removeEventListener(TypeName(i), other_listener,
+                                /*use_capture=*/false);
+  for (int i = 0; i < kNumTypes; ++i) {
+    bool has_listener = (kNumTypes - 1 - i) % 3 == 0;
+    bool has_other_listener = i % 2 == 1 && i % 5 != 0;
+    EXPECT_EQ(has_listener || has_other_listener,
+              target->HasEventListeners(TypeName(i)))
+        << i;
+  }
+
+  target->RemoveAllEventListeners();
+  for (int i = 0; i < kNumTypes; ++i)
+    EXPECT_FALSE(target->HasEventListeners(TypeName(i))) << i;
+  EXPECT_FALSE(target->HasEventListeners());
+}
+
+TEST_P(EventListenerMapTest, CapturingAndPassive) {
+  Persistent<Element> target =
+      GetDocument().CreateRawElement(html_names::kDivTag);
+  Persistent<EventListener> listener =
+      MakeGarbageCollected<EmptyEventListener>();
+
+  target->addEventListener(event_type_names::kWheel, listener,
+                           /*use_capture=*/true);
+  EXPECT_TRUE(target->HasCapturingEventListeners(event_type_names::kWheel));
+  EXPECT_FALSE(target->HasCapturingEventListeners(event_type_names::kScroll));
+  ASSERT_TRUE(target->GetEventListeners(event_type_names::kWheel));
+  EXPECT_EQ(1u, target->GetEventListeners(event_type_names::kWheel)->size());
+  EXPECT_FALSE(target->GetEventListeners(event_type_names::kScroll));
+
+  target->removeEventListener(event_type_names::kWheel, listener,
+                              /*use_capture=*/true);
+  EXPECT_FALSE(target->HasEventListeners(event_type_names::kWheel));
+  EXPECT_FALSE(target->GetEventListeners(event_type_names::kWheel));
+}
+
+}  // namespace blink
@@ -34,6 +34,8 @@
 #include "third_party/blink/renderer/core/html/html_slot_element.h"
 #include "third_party/blink/renderer/core/input/touch.h"
 #include "third_party/blink/renderer/core/input/touch_list.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -62,11 +64,26 @@ void EventPath::InitializeWith(Node& node, Event* event) {
   node_ = &node;
   event_ = event;
   window_event_context_ = nullptr;
+  shares_contexts_ = false;
   node_event_contexts_.clear();
   tree_scope_event_contexts_.clear();
   Initialize();
 }
 
+bool EventPathCache::Matches(const Node& node, const Event& event) const {
+  const Document& document = node.GetDocument();
+  return node_ == &node && event_type_ == event.type() &&
+         composed_ == event.composed() &&
+         dom_tree_version_ == document.DomTreeVersion() &&
+         slot_assignment_version_ == document.SlotAssignmentVersion();
+}
+
+void EventPathCache::Trace(Visitor* visitor) const {
+  visitor->Trace(node_);
+  visitor->Trace(node_event_contexts_);
+  visitor->Trace(tree_scope_event_contexts_);
+}
+
 static inline bool EventPathShouldBeEmptyFor(Node& node) {
   // Event path should be empty for orphaned pseudo elements, and nodes
   // whose document is stopped. In corner cases (crbug.com/1210480), the node
@@ -79,6 +96,51 @@ void EventPath::Initialize() {
   if (EventPathShouldBeEmptyFor(*node_))
     return;
 
+  if (InitializeFromCache())
+    return;
+
+  CalculatePath();
+  CalculateAdjustedTargets();
+  CalculateTreeOrderAndSetNearestAncestorClosedTree();
+  StoreInCache();
+}
+
+bool EventPath::InitializeFromCache() {
+  if (!event_ || !RuntimeEnabledFeatures::EventPathCacheEnabled())
+    return false;
+  EventPathCache* cache = node_->GetDocument().GetEventPathCache();
+  if (!cache || !cache->Matches(*node_, *event_))
+    return false;
+  node_event_contexts_ = cache->node_event_contexts_;
+  tree_scope_event_contexts_ = cache->tree_scope_event_contexts_;
+  shares_contexts_ = true;
+  return true;
+}
+
+void EventPath::StoreInCache() {
+  if (!event_ || !RuntimeEnabledFeatures::EventPathCacheEnabled())
+    return;
+  // Calculating the path does not mutate the DOM, so the versions are still
+  // the ones the path was calculated for.
+  Document& document = node_->GetDocument();
+  EventPathCache& cache = document.EnsureEventPathCache();
+  cache.node_ = node_;
+  cache.event_type_ = event_->type();
+  cache.composed_ = event_->composed();
+  cache.dom_tree_version_ = document.DomTreeVersion();
+  cache.slot_assignment_version_ = document.SlotAssignmentVersion();
+  cache.node_event_contexts_ = node_event_contexts_;
+  cache.tree_scope_event_contexts_ = tree_scope_event_contexts_;
+  shares_contexts_ = true;
+}
+
+void EventPath::EnsureContextsNotShared() {
+  if (!shares_contexts_)
+    return;
+  DCHECK(!window_event_context_);
+  shares_contexts_ = false;
+  node_event_contexts_.clear();
+  tree_scope_event_contexts_.clear();
   CalculatePath();
   CalculateAdjustedTargets();
   CalculateTreeOrderAndSetNearestAncestorClosedTree();
@@ -208,16 +270,26 @@ void EventPath::CalculateAdjustedTargets() {
 
 void EventPath::BuildRelatedNodeMap(const Node& related_node,
                                     RelatedTargetMap& related_target_map) {
-  EventPath* related_target_event_path =
-      MakeGarbageCollected<EventPath>(const_cast<Node&>(related_node));
+  // Boundary events of the pointer have related targets, so one EventPath is
+  // reused for the related nodes instead of allocating one per event. Nodes
+  // only exist on the main thread.
+  DCHECK(IsMainThread());
+  DEFINE_STATIC_LOCAL(Persistent<EventPath>, related_target_event_path, ());
+  Node& node = const_cast<Node&>(related_node);
+  if (!related_target_event_path)
+    related_target_event_path = MakeGarbageCollected<EventPath>(node);
+  else
+    related_target_event_path->InitializeWith(node, nullptr);
   for (const auto& tree_scope_event_context :
        related_target_event_path->tree_scope_event_contexts_) {
     related_target_map.insert(&tree_scope_event_context->GetTreeScope(),
                               tree_scope_event_context->Target());
   }
   // Oilpan: It is important to explicitly clear the vectors to reuse
-  // the memory in subsequent event dispatchings.
+  // the memory in subsequent event dispatchings. The node is dropped so that
+  // the reused path does not keep its document alive.
   related_target_event_path->Clear();
+  related_target_event_path->node_ = nullptr;
 }
 
 EventTarget* EventPath::FindRelatedNode(TreeScope& scope,
@@ -249,6 +321,7 @@ void EventPath::AdjustForRelatedTarget(Node& target,
     return;
   if (target.GetDocument() != related_target_node->GetDocument())
     return;
+  EnsureContextsNotShared();
   RetargetRelatedTarget(*related_target_node);
   ShrinkForRelatedTarget(target, *related_target_node);
 }
@@ -307,6 +380,8 @@ void EventPath::ShrinkForRelatedTarget(const Node& event_target_node,
 }
 
 void EventPath::AdjustForTouchEvent(const TouchEvent& touch_event) {
+  EnsureContextsNotShared();
+
   // Each vector and a TouchEventContext share the same TouchList instance.
   HeapVector<Member<TouchList>> adjusted_touches;
   HeapVector<Member<TouchList>> adjusted_target_touches;
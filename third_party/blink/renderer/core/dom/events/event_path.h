@@ -44,6 +44,34 @@ class TouchList;
 class TreeScope;
 class WindowEventContext;
 
+// The contexts of the last event path calculated in a document. Later
+// events of the same type to the same target share them instead of walking
+// the tree and allocating new TreeScopeEventContexts, as long as neither
+// the DOM tree nor any slot assignment changed. Owned by the Document, and
+// only used when the EventPathCache runtime flag is enabled.
+class CORE_EXPORT EventPathCache final
+    : public GarbageCollected<EventPathCache> {
+ public:
+  EventPathCache() = default;
+  EventPathCache(const EventPathCache&) = delete;
+  EventPathCache& operator=(const EventPathCache&) = delete;
+
+  void Trace(Visitor*) const;
+
+ private:
+  friend class EventPath;
+
+  bool Matches(const Node&, const Event&) const;
+
+  Member<Node> node_;
+  AtomicString event_type_;
+  bool composed_ = false;
+  uint64_t dom_tree_version_ = 0;
+  uint64_t slot_assignment_version_ = 0;
+  HeapVector<NodeEventContext> node_event_contexts_;
+  HeapVector<Member<TreeScopeEventContext>, 8> tree_scope_event_contexts_;
+};
+
 class CORE_EXPORT EventPath final : public GarbageCollected<EventPath> {
  public:
   explicit EventPath(Node&, Event* = nullptr);
@@ -95,6 +123,13 @@ class CORE_EXPORT EventPath final : public GarbageCollected<EventPath> {
   EventPath() = delete;
 
   void Initialize();
+  // Takes the contexts from the EventPathCache of the document if they are
+  // still valid for |node_| and |event_|, or stores the calculated ones.
+  bool InitializeFromCache();
+  void StoreInCache();
+  // Calculates contexts which are not shared with other paths, before they
+  // are adjusted for the event.
+  void EnsureContextsNotShared();
   void CalculatePath();
   void CalculateAdjustedTargets();
   void CalculateTreeOrderAndSetNearestAncestorClosedTree();
@@ -131,6 +166,9 @@ class CORE_EXPORT EventPath final : public GarbageCollected<EventPath> {
   Member<Event> event_;
   HeapVector<Member<TreeScopeEventContext>, 8> tree_scope_event_contexts_;
   Member<WindowEventContext> window_event_context_;
+  // Whether the contexts are shared with the EventPathCache, and therefore
+  // with other paths.
+  bool shares_contexts_ = false;
 };
 
 }  // namespace blink
@@ -7,10 +7,14 @@
 #include <memory>
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/events/event.h"
 #include "third_party/blink/renderer/core/dom/pseudo_element.h"
+#include "third_party/blink/renderer/core/dom/shadow_root.h"
+#include "third_party/blink/renderer/core/event_type_names.h"
 #include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/style/computed_style_constants.h"
 #include "third_party/blink/renderer/core/testing/page_test_base.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -25,4 +29,77 @@ TEST_F(EventPathTest, ShouldBeEmptyForPseudoElementWithoutParentElement) {
   EXPECT_TRUE(event_path.IsEmpty());
 }
 
+class EventPathCacheTest : public PageTestBase {
+ protected:
+  void SetUp() override {
+    PageTestBase::SetUp();
+    GetDocument().body()->setInnerHTML(
+        "<div id=host><span id=slotted></span></div>");
+    shadow_root_ = &GetElementById("host")->AttachShadowRootInternal(
+        ShadowRootType::kOpen);
+    shadow_root_->setInnerHTML("<div><slot></slot></div>");
+  }
+
+  EventPath* PathFor(Node& node) {
+    return MakeGarbageCollected<EventPath>(
+        node, Event::CreateBubble(event_type_names::kPointermove));
+  }
+
+  // Checks that |path| has the same nodes and adjusted targets as a path
+  // calculated without the cache.
+  void ExpectPathMatchesUncached(EventPath& path, Node& node) {
+    ScopedEventPathCacheForTest disabled(false);
+    EventPath* expected = PathFor(node);
+    ASSERT_EQ(expected->size(), path.size());
+    for (wtf_size_t i = 0; i < path.size(); ++i) {
+      EXPECT_EQ(&(*expected)[i].GetNode(), &path[i].GetNode()) << i;
+      EXPECT_EQ((*expected)[i].Target(), path[i].Target()) << i;
+    }
+  }
+
+  ScopedEventPathCacheForTest event_path_cache_{true};
+  Persistent<ShadowRoot> shadow_root_;
+};
+
+TEST_F(EventPathCacheTest, SharedForSameTarget) {
+  Element* slotted = GetElementById("slotted");
+  EventPath* first = PathFor(*slotted);
+  EventPath* second = PathFor(*slotted);
+  ExpectPathMatchesUncached(*second, *slotted);
+  // The tree scope contexts are shared.
+  EXPECT_EQ(&(*first)[0].GetTreeScopeEventContext(),
+            &(*second)[0].GetTreeScopeEventContext());
+
+  // Other targets do not share the path.
+  EventPath* other = PathFor(*GetElementById("host"));
+  ExpectPathMatchesUncached(*other, *GetElementById("host"));
+  EXPECT_NE(&(*first).Last().GetTreeScopeEventContext(),
+            &(*other).Last().GetTreeScopeEventContext());
+}
+
+TEST_F(EventPathCacheTest, NotSharedAfterDOMChange) {
+  Element* slotted = GetElementById("slotted");
+  EventPath* first = PathFor(*slotted);
+
+  // The slot is wrapped in another element.
+  shadow_root_->setInnerHTML("<div><p><slot></slot></p></div>");
+  EventPath* second = PathFor(*slotted);
+  ExpectPathMatchesUncached(*second, *slotted);
+  EXPECT_EQ(first->size() + 1, second->size());
+}
+
+TEST_F(EventPathCacheTest, NotSharedAfterSlotAssignmentChange) {
+  shadow_root_->setInnerHTML(
+      "<div><slot></slot></div><p><slot name=named></slot></p>");
+  Element* slotted = GetElementById("slotted");
+  EventPath* first = PathFor(*slotted);
+  ExpectPathMatchesUncached(*first, *slotted);
+
+  // Only the slot assignment changes, not the DOM tree.
+  slotted->setAttribute(html_names::kSlotAttr, "named");
+  EventPath* second = PathFor(*slotted);
+  ExpectPathMatchesUncached(*second, *slotted);
+  EXPECT_NE(&(*first)[1].GetNode(), &(*second)[1].GetNode());
+}
+
 }  // namespace blink
@@ -46,6 +46,7 @@
 #include "third_party/blink/renderer/core/probe/core_probes.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
 #include "third_party/blink/renderer/platform/bindings/microtask.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -264,6 +265,21 @@ static void ActivateObserver(MutationObserver* observer) {
 
 void MutationObserver::EnqueueMutationRecord(MutationRecord* mutation) {
   DCHECK(IsMainThread());
+  if (RuntimeEnabledFeatures::CoalescedMutationRecordsEnabled() &&
+      !records_.IsEmpty()) {
+    // Frameworks often insert or remove many children one by one, so a
+    // childList record which continues the last one is merged into it. The
+    // observer is already active for the last record.
+    if (MutationRecord* coalesced =
+            MutationRecord::CoalesceChildList(*records_.back(), *mutation)) {
+      if (coalesced != records_.back()) {
+        records_.back() = coalesced;
+        coalesced->async_task_context()->Schedule(
+            delegate_->GetExecutionContext(), coalesced->type());
+      }
+      return;
+    }
+  }
   records_.push_back(mutation);
   ActivateObserver(this);
   mutation->async_task_context()->Schedule(delegate_->GetExecutionContext(),
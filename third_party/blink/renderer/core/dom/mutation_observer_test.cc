@@ -7,10 +7,13 @@
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_mutation_observer_init.h"
 #include "third_party/blink/renderer/core/dom/mutation_observer_registration.h"
+#include "third_party/blink/renderer/core/dom/mutation_record.h"
+#include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/html/html_document.h"
 #include "third_party/blink/renderer/core/html/html_element.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/heap/thread_state.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -35,6 +38,15 @@ class EmptyMutationCallback : public MutationObserver::Delegate {
   Member<Document> document_;
 };
 
+MutationObserver* ObserveChildList(Document& document, Node& target) {
+  MutationObserver* observer = MutationObserver::Create(
+      MakeGarbageCollected<EmptyMutationCallback>(document));
+  MutationObserverInit* init = MutationObserverInit::Create();
+  init->setChildList(true);
+  observer->observe(&target, init, ASSERT_NO_EXCEPTION);
+  return observer;
+}
+
 }  // namespace
 
 TEST(MutationObserverTest, DisconnectCrash) {
@@ -62,4 +74,108 @@ TEST(MutationObserverTest, DisconnectCrash) {
   // The test passes if disconnect() didn't crash.  crbug.com/657613.
 }
 
+class CoalescedMutationRecordsTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    document_ = HTMLDocument::CreateForTest();
+    root_ = document_->CreateRawElement(html_names::kHTMLTag);
+    document_->AppendChild(root_);
+  }
+
+  Element* CreateChild() {
+    return document_->CreateRawElement(html_names::kDivTag);
+  }
+
+  ScopedCoalescedMutationRecordsForTest coalesced_mutation_records_{true};
+  Persistent<Document> document_;
+  Persistent<Element> root_;
+};
+
+TEST_F(CoalescedMutationRecordsTest, Appends) {
+  Element* first = CreateChild();
+  root_->AppendChild(first);
+  Persistent<MutationObserver> observer = ObserveChildList(*document_, *root_);
+
+  Element* children[3] = {CreateChild(), CreateChild(), CreateChild()};
+  for (Element* child : children)
+    root_->AppendChild(child);
+
+  MutationRecordVector records = observer->takeRecords();
+  ASSERT_EQ(1u, records.size());
+  MutationRecord* record = records[0];
+  EXPECT_EQ(root_, record->target());
+  ASSERT_EQ(3u, record->addedNodes()->length());
+  for (unsigned i = 0; i < 3; ++i)
+    EXPECT_EQ(children[i], record->addedNodes()->item(i));
+  EXPECT_EQ(0u, record->removedNodes()->length());
+  EXPECT_EQ(first, record->previousSibling());
+  EXPECT_EQ(nullptr, record->nextSibling());
+
+  {
+    ScopedCoalescedMutationRecordsForTest disabled(false);
+    for (unsigned i = 0; i < 3; ++i)
+      root_->AppendChild(CreateChild());
+    EXPECT_EQ(3u, observer->takeRecords().size());
+  }
+}
+
+TEST_F(CoalescedMutationRecordsTest, Removals) {
+  Element* children[4] = {CreateChild(), CreateChild(), CreateChild(),
+                          CreateChild()};
+  for (Element* child : children)
+    root_->AppendChild(child);
+  Persistent<MutationObserver> observer = ObserveChildList(*document_, *root_);
+
+  children[1]->remove();
+  children[2]->remove();
+
+  MutationRecordVector records = observer->takeRecords();
+  ASSERT_EQ(1u, records.size());
+  MutationRecord* record = records[0];
+  EXPECT_EQ(0u, record->addedNodes()->length());
+  ASSERT_EQ(2u, record->removedNodes()->length());
+  EXPECT_EQ(children[1], record->removedNodes()->item(0));
+  EXPECT_EQ(children[2], record->removedNodes()->item(1));
+  EXPECT_EQ(children[0], record->previousSibling());
+  EXPECT_EQ(children[3], record->nextSibling());
+}
+
+TEST_F(CoalescedMutationRecordsTest, NotContiguous) {
+  Element* child = CreateChild();
+  root_->AppendChild(child);
+  Persistent<MutationObserver> observer = ObserveChildList(*document_, *root_);
+
+  // Insertions which are not right after the last inserted node, and an
+  // insertion followed by a removal.
+  root_->AppendChild(CreateChild());
+  root_->insertBefore(CreateChild(), child);
+  root_->AppendChild(CreateChild());
+  child->remove();
+  EXPECT_EQ(4u, observer->takeRecords().size());
+}
+
+TEST_F(CoalescedMutationRecordsTest, SharedRecord) {
+  Persistent<MutationObserver> observer = ObserveChildList(*document_, *root_);
+  Persistent<MutationObserver> other_observer =
+      ObserveChildList(*document_, *root_);
+
+  // The record of the first insertion is queued for both observers.
+  Element* first = CreateChild();
+  root_->AppendChild(first);
+  MutationRecordVector other_records = other_observer->takeRecords();
+  ASSERT_EQ(1u, other_records.size());
+
+  root_->AppendChild(CreateChild());
+  root_->AppendChild(CreateChild());
+  MutationRecordVector records = observer->takeRecords();
+  ASSERT_EQ(1u, records.size());
+  EXPECT_NE(other_records[0], records[0]);
+  EXPECT_EQ(3u, records[0]->addedNodes()->length());
+  EXPECT_EQ(first, records[0]->addedNodes()->item(0));
+  EXPECT_EQ(1u, other_observer->takeRecords().size());
+
+  ASSERT_EQ(1u, other_records[0]->addedNodes()->length());
+  EXPECT_EQ(first, other_records[0]->addedNodes()->item(0));
+}
+
 }  // namespace blink
@@ -43,18 +43,62 @@ namespace {
 class ChildListRecord : public MutationRecord {
  public:
   ChildListRecord(Node* target,
-                  StaticNodeList* added,
-                  StaticNodeList* removed,
+                  HeapVector<Member<Node>>& added,
+                  HeapVector<Member<Node>>& removed,
                   Node* previous_sibling,
                   Node* next_sibling)
       : target_(target),
-        added_nodes_(added),
-        removed_nodes_(removed),
         previous_sibling_(previous_sibling),
-        next_sibling_(next_sibling) {}
+        next_sibling_(next_sibling) {
+    added_.swap(added);
+    removed_.swap(removed);
+  }
+
+  // Creates a record which is not shared, for coalescing further records.
+  explicit ChildListRecord(const ChildListRecord& other)
+      : target_(other.target_),
+        added_(other.added_),
+        removed_(other.removed_),
+        previous_sibling_(other.previous_sibling_),
+        next_sibling_(other.next_sibling_),
+        coalesced_(true) {}
+
+  bool IsCoalesced() const { return coalesced_; }
+
+  // Whether the mutations of |next| continue the ones of this record, either
+  // by inserting nodes right after the last inserted one, or by removing
+  // nodes right after the last removed one.
+  bool IsContinuedBy(const ChildListRecord& next) const {
+    if (target_ != next.target_)
+      return false;
+    if (removed_.IsEmpty() && next.removed_.IsEmpty()) {
+      return !added_.IsEmpty() && next.previous_sibling_ == added_.back() &&
+             next.next_sibling_ == next_sibling_;
+    }
+    if (added_.IsEmpty() && next.added_.IsEmpty()) {
+      return next.previous_sibling_ == previous_sibling_ &&
+             next.removed_.front() == next_sibling_;
+    }
+    return false;
+  }
+
+  // Only valid before the node lists are accessed.
+  void Append(const ChildListRecord& next) {
+    DCHECK(coalesced_);
+    DCHECK(!HasNodeLists());
+    DCHECK(IsContinuedBy(next));
+    added_.AppendVector(next.added_);
+    removed_.AppendVector(next.removed_);
+    if (!next.removed_.IsEmpty())
+      next_sibling_ = next.next_sibling_;
+  }
+
+  bool HasNodeLists() const { return added_nodes_ || removed_nodes_; }
 
   void Trace(Visitor* visitor) const override {
     visitor->Trace(target_);
+    visitor->Trace(added_);
+    visitor->Trace(removed_);
     visitor->Trace(added_nodes_);
     visitor->Trace(removed_nodes_);
     visitor->Trace(previous_sibling_);
@@ -63,18 +107,31 @@ class ChildListRecord : public MutationRecord {
   }
 
  private:
+  bool IsChildListRecord() const override { return true; }
   const AtomicString& type() override;
   Node* target() override { return target_.Get(); }
-  StaticNodeList* addedNodes() override { return added_nodes_.Get(); }
-  StaticNodeList* removedNodes() override { return removed_nodes_.Get(); }
+  StaticNodeList* addedNodes() override {
+    if (!added_nodes_)
+      added_nodes_ = StaticNodeList::Adopt(added_);
+    return added_nodes_.Get();
+  }
+  StaticNodeList* removedNodes() override {
+    if (!removed_nodes_)
+      removed_nodes_ = StaticNodeList::Adopt(removed_);
+    return removed_nodes_.Get();
+  }
   Node* previousSibling() override { return previous_sibling_.Get(); }
   Node* nextSibling() override { return next_sibling_.Get(); }
 
   Member<Node> target_;
+  // The nodes until the node lists are created.
+  HeapVector<Member<Node>> added_;
+  HeapVector<Member<Node>> removed_;
   Member<StaticNodeList> added_nodes_;
   Member<StaticNodeList> removed_nodes_;
   Member<Node> previous_sibling_;
   Member<Node> next_sibling_;
+  bool coalesced_ = false;
 };
 
 class RecordWithEmptyNodeLists : public MutationRecord {
@@ -186,11 +243,12 @@ const AtomicString& CharacterDataRecord::type() {
 
 }  // namespace
 
-MutationRecord* MutationRecord::CreateChildList(Node* target,
-                                                StaticNodeList* added,
-                                                StaticNodeList* removed,
-                                                Node* previous_sibling,
-                                                Node* next_sibling) {
+MutationRecord* MutationRecord::CreateChildList(
+    Node* target,
+    HeapVector<Member<Node>>& added,
+    HeapVector<Member<Node>>& removed,
+    Node* previous_sibling,
+    Node* next_sibling) {
   return MakeGarbageCollected<ChildListRecord>(target, added, removed,
                                                previous_sibling, next_sibling);
 }
@@ -211,6 +269,27 @@ MutationRecord* MutationRecord::CreateWithNullOldValue(MutationRecord* record) {
   return MakeGarbageCollected<MutationRecordWithNullOldValue>(record);
 }
 
+MutationRecord* MutationRecord::CoalesceChildList(MutationRecord& last,
+                                                  MutationRecord& next) {
+  if (!last.IsChildListRecord() || !next.IsChildListRecord())
+    return nullptr;
+  auto& last_record = static_cast<ChildListRecord&>(last);
+  auto& next_record = static_cast<ChildListRecord&>(next);
+  // Records which script has seen are not changed anymore.
+  if (last_record.HasNodeLists() || next_record.HasNodeLists())
+    return nullptr;
+  if (!last_record.IsContinuedBy(next_record))
+    return nullptr;
+  // Unless it was coalesced before, |last| may be queued for other observers
+  // as well, so the mutations are coalesced into a copy.
+  ChildListRecord* coalesced =
+      last_record.IsCoalesced()
+          ? &last_record
+          : MakeGarbageCollected<ChildListRecord>(last_record);
+  coalesced->Append(next_record);
+  return coalesced;
+}
+
 MutationRecord::~MutationRecord() = default;
 
 }  // namespace blink
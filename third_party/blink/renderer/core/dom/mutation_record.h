@@ -35,6 +35,7 @@
 #include "third_party/blink/renderer/core/dom/static_node_list.h"
 #include "third_party/blink/renderer/core/probe/async_task_context.h"
 #include "third_party/blink/renderer/platform/bindings/script_wrappable.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace blink {
@@ -48,9 +49,11 @@ class CORE_EXPORT MutationRecord : public ScriptWrappable {
   DEFINE_WRAPPERTYPEINFO();
 
  public:
+  // Adopts the contents of |added| and |removed|. The node lists are only
+  // created when they are first accessed.
   static MutationRecord* CreateChildList(Node* target,
-                                         StaticNodeList* added,
-                                         StaticNodeList* removed,
+                                         HeapVector<Member<Node>>& added,
+                                         HeapVector<Member<Node>>& removed,
                                          Node* previous_sibling,
                                          Node* next_sibling);
   static MutationRecord* CreateAttributes(Node* target,
@@ -60,6 +63,14 @@ class CORE_EXPORT MutationRecord : public ScriptWrappable {
                                              const String& old_value);
   static MutationRecord* CreateWithNullOldValue(MutationRecord*);
 
+  // Returns a childList record for the mutations of |last| followed by those
+  // of |next|, if both are childList records of the same target, and |next|
+  // continues the insertions or the removals of |last|. Returns null
+  // otherwise. The returned record is not shared with other observers, and is
+  // |last| itself if |last| was returned by an earlier call.
+  static MutationRecord* CoalesceChildList(MutationRecord& last,
+                                           MutationRecord& next);
+
   MutationRecord() = default;
 
   ~MutationRecord() override;
@@ -80,6 +91,8 @@ class CORE_EXPORT MutationRecord : public ScriptWrappable {
   probe::AsyncTaskContext* async_task_context() { return &async_task_context_; }
 
  private:
+  virtual bool IsChildListRecord() const { return false; }
+
   probe::AsyncTaskContext async_task_context_;
 };
 
@@ -67,6 +67,7 @@
 #include "third_party/blink/renderer/core/dom/node_lists_node_data.h"
 #include "third_party/blink/renderer/core/dom/node_rare_data.h"
 #include "third_party/blink/renderer/core/dom/node_traversal.h"
+#include "third_party/blink/renderer/core/dom/nth_index_cache.h"
 #include "third_party/blink/renderer/core/dom/processing_instruction.h"
 #include "third_party/blink/renderer/core/dom/range.h"
 #include "third_party/blink/renderer/core/dom/shadow_root.h"
@@ -2636,6 +2637,13 @@ void Node::DidMoveToNewDocument(Document& old_document) {
   }
   if (auto* text_node = DynamicTo<Text>(this))
     old_document.Markers().RemoveMarkersForNode(*text_node);
+  if (auto* container_node = DynamicTo<ContainerNode>(this)) {
+    // The children of this node are no longer mutated in |old_document|.
+    if (OrderedNthIndexCache* nth_index_cache =
+            old_document.GetOrderedNthIndexCache()) {
+      nth_index_cache->ParentRemoved(*container_node);
+    }
+  }
   if (GetDocument().GetPage() &&
       GetDocument().GetPage() != old_document.GetPage()) {
     GetDocument().GetFrame()->GetEventHandlerRegistry().DidMoveIntoPage(*this);
@@ -6,6 +6,7 @@
 
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/element_traversal.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -76,11 +77,28 @@ unsigned UncachedNthLastOfTypeIndex(Element& element, unsigned& sibling_count) {
   return index;
 }
 
+// The number of parents for which OrderedNthIndexCache keeps data.
+const unsigned kMaxOrderedCachedParents = 256;
+
+// The key of the OrderedNthIndexData of the type of |element|. Prefixes are
+// ignored when matching the type, so they are dropped from the key.
+QualifiedName TypeKey(const Element& element) {
+  const QualifiedName& tag_name = element.TagQName();
+  if (tag_name.Prefix().IsNull())
+    return tag_name;
+  return QualifiedName(g_null_atom, tag_name.LocalName(),
+                       tag_name.NamespaceURI());
+}
+
 }  // namespace
 
 unsigned NthIndexCache::NthChildIndex(Element& element) {
   if (element.IsPseudoElement() || !element.parentNode())
     return 1;
+  if (RuntimeEnabledFeatures::OrderedNthIndexCacheEnabled()) {
+    return element.GetDocument().EnsureOrderedNthIndexCache().NthChildIndex(
+        element);
+  }
   NthIndexCache* nth_index_cache = element.GetDocument().GetNthIndexCache();
   NthIndexData* nth_index_data = nullptr;
   if (nth_index_cache && nth_index_cache->parent_map_) {
@@ -99,6 +117,12 @@ unsigned NthIndexCache::NthChildIndex(Element& element) {
 unsigned NthIndexCache::NthLastChildIndex(Element& element) {
   if (element.IsPseudoElement() && !element.parentNode())
     return 1;
+  if (RuntimeEnabledFeatures::OrderedNthIndexCacheEnabled() &&
+      element.parentNode()) {
+    return element.GetDocument()
+        .EnsureOrderedNthIndexCache()
+        .NthLastChildIndex(element);
+  }
   NthIndexCache* nth_index_cache = element.GetDocument().GetNthIndexCache();
   NthIndexData* nth_index_data = nullptr;
   if (nth_index_cache && nth_index_cache->parent_map_) {
@@ -132,6 +156,10 @@ NthIndexData* NthIndexCache::NthTypeIndexDataForParent(Element& element) const {
 unsigned NthIndexCache::NthOfTypeIndex(Element& element) {
   if (element.IsPseudoElement() || !element.parentNode())
     return 1;
+  if (RuntimeEnabledFeatures::OrderedNthIndexCacheEnabled()) {
+    return element.GetDocument().EnsureOrderedNthIndexCache().NthOfTypeIndex(
+        element);
+  }
   NthIndexCache* nth_index_cache = element.GetDocument().GetNthIndexCache();
   if (nth_index_cache) {
     if (NthIndexData* nth_index_data =
@@ -148,6 +176,11 @@ unsigned NthIndexCache::NthOfTypeIndex(Element& element) {
 unsigned NthIndexCache::NthLastOfTypeIndex(Element& element) {
   if (element.IsPseudoElement() || !element.parentNode())
     return 1;
+  if (RuntimeEnabledFeatures::OrderedNthIndexCacheEnabled()) {
+    return element.GetDocument()
+        .EnsureOrderedNthIndexCache()
+        .NthLastOfTypeIndex(element);
+  }
   NthIndexCache* nth_index_cache = element.GetDocument().GetNthIndexCache();
   if (nth_index_cache) {
     if (NthIndexData* nth_index_data =
@@ -273,4 +306,239 @@ void NthIndexData::Trace(Visitor* visitor) const {
   visitor->Trace(element_index_map_);
 }
 
+OrderedNthIndexData::OrderedNthIndexData(ContainerNode& parent,
+                                         const QualifiedName& type)
+    : parent_(&parent), type_(type) {
+  UpdateIndices();
+  count_ = valid_count_;
+  DCHECK(count_);
+}
+
+Element* OrderedNthIndexData::MatchingElementAtOrBefore(Node* node) const {
+  for (; node; node = node->previousSibling()) {
+    auto* element = DynamicTo<Element>(node);
+    if (element && Matches(*element))
+      return element;
+  }
+  return nullptr;
+}
+
+unsigned OrderedNthIndexData::ValidIndex(const Element& element) const {
+  auto it = label_map_.find(&element);
+  if (it == label_map_.end())
+    return 0;
+  // Labels outside of the valid prefix are stale, but always map to indices
+  // after it.
+  int index = it->value - offset_;
+  DCHECK_GT(index, 0);
+  return static_cast<unsigned>(index) <= valid_count_ ? index : 0;
+}
+
+void OrderedNthIndexData::UpdateIndices() {
+  Element* child = last_valid_ ? ElementTraversal::NextSibling(*last_valid_)
+                               : ElementTraversal::FirstChild(*parent_);
+  for (; child; child = ElementTraversal::NextSibling(*child)) {
+    if (!Matches(*child))
+      continue;
+    label_map_.Set(child, static_cast<int>(++valid_count_) + offset_);
+    last_valid_ = child;
+  }
+  DCHECK(!count_ || count_ == valid_count_);
+}
+
+unsigned OrderedNthIndexData::NthIndex(Element& element) {
+  DCHECK(!element.IsPseudoElement());
+  DCHECK(Matches(element));
+
+  if (unsigned index = ValidIndex(element))
+    return index;
+  UpdateIndices();
+  return ValidIndex(element);
+}
+
+unsigned OrderedNthIndexData::NthLastIndex(Element& element) {
+  unsigned index = NthIndex(element);
+  return count_ - index + 1;
+}
+
+void OrderedNthIndexData::ChildInserted(Element& child) {
+  DCHECK(Matches(child));
+  DCHECK_EQ(child.parentNode(), parent_);
+  bool all_valid = valid_count_ == count_;
+  ++count_;
+  Element* previous = MatchingElementAtOrBefore(child.previousSibling());
+  if (!previous) {
+    // All other children move one index up.
+    --offset_;
+    label_map_.Set(&child, 1 + offset_);
+    if (!valid_count_++)
+      last_valid_ = &child;
+    return;
+  }
+  unsigned previous_index = ValidIndex(*previous);
+  if (!previous_index)
+    return;
+  if (previous_index == valid_count_ && all_valid) {
+    // Appended after the last child.
+    label_map_.Set(&child, static_cast<int>(++valid_count_) + offset_);
+    last_valid_ = &child;
+    return;
+  }
+  // The children after |previous| are stale now, and |child| is labeled on
+  // the next lookup.
+  valid_count_ = previous_index;
+  last_valid_ = previous;
+}
+
+void OrderedNthIndexData::ChildRemoved(Element& child, Node* previous_sibling) {
+  DCHECK(Matches(child));
+  DCHECK(count_);
+  unsigned index = ValidIndex(child);
+  label_map_.erase(&child);
+  --count_;
+  if (!index)
+    return;
+  if (index == 1) {
+    // All other children move one index down.
+    ++offset_;
+    if (!--valid_count_)
+      last_valid_ = nullptr;
+    return;
+  }
+  valid_count_ = index - 1;
+  last_valid_ = MatchingElementAtOrBefore(previous_sibling);
+  DCHECK(last_valid_);
+}
+
+void OrderedNthIndexData::Trace(Visitor* visitor) const {
+  visitor->Trace(parent_);
+  visitor->Trace(label_map_);
+  visitor->Trace(last_valid_);
+}
+
+OrderedNthIndexData* OrderedNthIndexCache::IndexDataForParent(
+    Element& element) const {
+  auto it = parent_map_.find(element.parentNode());
+  return it != parent_map_.end() ? it->value : nullptr;
+}
+
+OrderedNthIndexData* OrderedNthIndexCache::TypeIndexDataForParent(
+    Element& element) const {
+  auto it_parent = parent_map_for_type_.find(element.parentNode());
+  if (it_parent == parent_map_for_type_.end())
+    return nullptr;
+  auto it_map = it_parent->value->find(TypeKey(element));
+  return it_map != it_parent->value->end() ? it_map->value : nullptr;
+}
+
+void OrderedNthIndexCache::EnsureCapacity() {
+  // Dropping everything keeps the bookkeeping trivial, and the data for the
+  // parents which are still styled is built again on the next lookup.
+  if (parent_map_.size() + parent_map_for_type_.size() >=
+      kMaxOrderedCachedParents) {
+    parent_map_.clear();
+    parent_map_for_type_.clear();
+  }
+}
+
+void OrderedNthIndexCache::CacheIndexDataForParent(Element& element) {
+  DCHECK(element.parentNode());
+  EnsureCapacity();
+  parent_map_.insert(element.parentNode(),
+                     MakeGarbageCollected<OrderedNthIndexData>(
+                         *element.parentNode(), QualifiedName::Null()));
+}
+
+void OrderedNthIndexCache::CacheTypeIndexDataForParent(Element& element) {
+  DCHECK(element.parentNode());
+  IndexByType* index_by_type = nullptr;
+  auto it = parent_map_for_type_.find(element.parentNode());
+  if (it != parent_map_for_type_.end()) {
+    index_by_type = it->value;
+  } else {
+    EnsureCapacity();
+    index_by_type = MakeGarbageCollected<IndexByType>();
+    parent_map_for_type_.insert(element.parentNode(), index_by_type);
+  }
+  QualifiedName type = TypeKey(element);
+  index_by_type->insert(type, MakeGarbageCollected<OrderedNthIndexData>(
+                                  *element.parentNode(), type));
+}
+
+unsigned OrderedNthIndexCache::NthChildIndex(Element& element) {
+  if (OrderedNthIndexData* data = IndexDataForParent(element))
+    return data->NthIndex(element);
+  unsigned index = UncachedNthChildIndex(element);
+  if (index > kCachedSiblingCountLimit)
+    CacheIndexDataForParent(element);
+  return index;
+}
+
+unsigned OrderedNthIndexCache::NthLastChildIndex(Element& element) {
+  if (OrderedNthIndexData* data = IndexDataForParent(element))
+    return data->NthLastIndex(element);
+  unsigned index = UncachedNthLastChildIndex(element);
+  if (index > kCachedSiblingCountLimit)
+    CacheIndexDataForParent(element);
+  return index;
+}
+
+unsigned OrderedNthIndexCache::NthOfTypeIndex(Element& element) {
+  if (OrderedNthIndexData* data = TypeIndexDataForParent(element))
+    return data->NthIndex(element);
+  unsigned sibling_count = 0;
+  unsigned index = UncachedNthOfTypeIndex(element, sibling_count);
+  if (sibling_count > kCachedSiblingCountLimit)
+    CacheTypeIndexDataForParent(element);
+  return index;
+}
+
+unsigned OrderedNthIndexCache::NthLastOfTypeIndex(Element& element) {
+  if (OrderedNthIndexData* data = TypeIndexDataForParent(element))
+    return data->NthLastIndex(element);
+  unsigned sibling_count = 0;
+  unsigned index = UncachedNthLastOfTypeIndex(element, sibling_count);
+  if (sibling_count > kCachedSiblingCountLimit)
+    CacheTypeIndexDataForParent(element);
+  return index;
+}
+
+void OrderedNthIndexCache::ChildrenChanged(
+    ContainerNode& parent,
+    const ContainerNode::ChildrenChange& change) {
+  if (change.type == ContainerNode::ChildrenChangeType::kAllChildrenRemoved) {
+    ParentRemoved(parent);
+    return;
+  }
+  if (!change.IsChildElementChange())
+    return;
+
+  auto& child = To<Element>(*change.sibling_changed);
+  auto notify = [&change, &child](OrderedNthIndexData& data) {
+    if (change.IsChildInsertion())
+      data.ChildInserted(child);
+    else
+      data.ChildRemoved(child, change.sibling_before_change);
+  };
+  auto it = parent_map_.find(&parent);
+  if (it != parent_map_.end())
+    notify(*it->value);
+  auto it_parent = parent_map_for_type_.find(&parent);
+  if (it_parent != parent_map_for_type_.end()) {
+    auto it_map = it_parent->value->find(TypeKey(child));
+    if (it_map != it_parent->value->end())
+      notify(*it_map->value);
+  }
+}
+
+void OrderedNthIndexCache::ParentRemoved(ContainerNode& parent) {
+  parent_map_.erase(&parent);
+  parent_map_for_type_.erase(&parent);
+}
+
+void OrderedNthIndexCache::Trace(Visitor* visitor) const {
+  visitor->Trace(parent_map_);
+  visitor->Trace(parent_map_for_type_);
+}
+
 }  // namespace blink
@@ -34,6 +34,102 @@ class CORE_EXPORT NthIndexData final : public GarbageCollected<NthIndexData> {
   unsigned count_ = 0;
 };
 
+// The nth-index data of the element children of a parent, or of its element
+// children of one type, which is kept up to date when children are inserted
+// or removed.
+//
+// Each counted child is mapped to a label, and its index is the label minus
+// |offset_|. The indices of a prefix of the children, up to |last_valid_|,
+// are known to be correct, and the rest are relabeled on the next lookup.
+// Inserting or removing the first child only adjusts |offset_|, and
+// appending a child labels it, so that the common mutations of long lists
+// keep all indices valid. Other mutations shrink the valid prefix to the
+// mutated position.
+class CORE_EXPORT OrderedNthIndexData final
+    : public GarbageCollected<OrderedNthIndexData> {
+ public:
+  // Counts all element children of |parent| if |type| is null.
+  OrderedNthIndexData(ContainerNode& parent, const QualifiedName& type);
+  OrderedNthIndexData(const OrderedNthIndexData&) = delete;
+  OrderedNthIndexData& operator=(const OrderedNthIndexData&) = delete;
+
+  unsigned NthIndex(Element&);
+  unsigned NthLastIndex(Element&);
+
+  // Called after |child|, which matches the type, was inserted. For multiple
+  // inserted children, this must be called in tree order.
+  void ChildInserted(Element& child);
+  // Called after |child|, which matches the type, was removed.
+  // |previous_sibling| is the previous sibling of |child| before the removal.
+  void ChildRemoved(Element& child, Node* previous_sibling);
+
+  void Trace(Visitor*) const;
+
+ private:
+  bool Matches(const Element& element) const {
+    return type_ == QualifiedName::Null() || element.HasTagName(type_);
+  }
+  Element* MatchingElementAtOrBefore(Node*) const;
+  // Returns the index of |element| if it is in the valid prefix, or 0.
+  unsigned ValidIndex(const Element&) const;
+  void UpdateIndices();
+
+  Member<ContainerNode> parent_;
+  const QualifiedName type_;
+  HeapHashMap<Member<Element>, int> label_map_;
+  int offset_ = 0;
+  // The number of children with valid indices, and the last one of them.
+  unsigned valid_count_ = 0;
+  Member<Element> last_valid_;
+  unsigned count_ = 0;
+};
+
+// Keeps OrderedNthIndexData for the parents with many children in a document
+// across style recalcs. It is owned by the Document and used instead of the
+// scoped NthIndexCache data when the OrderedNthIndexCache runtime flag is
+// enabled. The parents are held weakly, and the number of cached parents is
+// bounded.
+class CORE_EXPORT OrderedNthIndexCache final
+    : public GarbageCollected<OrderedNthIndexCache> {
+ public:
+  OrderedNthIndexCache() = default;
+  OrderedNthIndexCache(const OrderedNthIndexCache&) = delete;
+  OrderedNthIndexCache& operator=(const OrderedNthIndexCache&) = delete;
+
+  unsigned NthChildIndex(Element&);
+  unsigned NthLastChildIndex(Element&);
+  unsigned NthOfTypeIndex(Element&);
+  unsigned NthLastOfTypeIndex(Element&);
+
+  // Called from ContainerNode::ChildrenChanged().
+  void ChildrenChanged(ContainerNode& parent,
+                       const ContainerNode::ChildrenChange&);
+  // Called for a parent which moved to another document.
+  void ParentRemoved(ContainerNode& parent);
+
+  wtf_size_t CachedParentCountForTesting() const {
+    return parent_map_.size() + parent_map_for_type_.size();
+  }
+
+  void Trace(Visitor*) const;
+
+ private:
+  using IndexByType = HeapHashMap<QualifiedName, Member<OrderedNthIndexData>>;
+  using ParentMap =
+      HeapHashMap<WeakMember<ContainerNode>, Member<OrderedNthIndexData>>;
+  using ParentMapForType =
+      HeapHashMap<WeakMember<ContainerNode>, Member<IndexByType>>;
+
+  OrderedNthIndexData* IndexDataForParent(Element&) const;
+  OrderedNthIndexData* TypeIndexDataForParent(Element&) const;
+  void CacheIndexDataForParent(Element&);
+  void CacheTypeIndexDataForParent(Element&);
+  void EnsureCapacity();
+
+  ParentMap parent_map_;
+  ParentMapForType parent_map_for_type_;
+};
+
 class CORE_EXPORT NthIndexCache final {
   STACK_ALLOCATED();
 
@@ -7,8 +7,13 @@
 #include <memory>
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element_traversal.h"
 #include "third_party/blink/renderer/core/html/html_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/testing/page_test_base.h"
+#include "third_party/blink/renderer/platform/heap/thread_state.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 
 namespace blink {
 
@@ -37,4 +42,140 @@ TEST_F(NthIndexCacheTest, NthIndex) {
       12U);
 }
 
+class OrderedNthIndexCacheTest : public PageTestBase {
+ protected:
+  void SetUp() override {
+    PageTestBase::SetUp();
+    StringBuilder html;
+    html.Append("<div id=parent>");
+    for (int i = 0; i < 40; ++i)
+      html.Append(i % 4 ? "<span></span>" : "<b></b>");
+    html.Append("</div>");
+    GetDocument().body()->setInnerHTML(html.ToString());
+  }
+
+  Element& Parent() { return *GetElementById("parent"); }
+
+  // Checks the indices of all children of the parent against a walk of the
+  // children.
+  void ExpectIndices() {
+    HeapVector<Member<Element>> children;
+    for (Element& child : ElementTraversal::ChildrenOf(Parent()))
+      children.push_back(&child);
+    for (wtf_size_t i = 0; i < children.size(); ++i) {
+      Element& child = *children[i];
+      unsigned of_type = 0;
+      unsigned of_type_count = 0;
+      for (wtf_size_t j = 0; j < children.size(); ++j) {
+        if (children[j]->TagQName() != child.TagQName())
+          continue;
+        ++of_type_count;
+        if (j <= i)
+          ++of_type;
+      }
+      EXPECT_EQ(i + 1, NthIndexCache::NthChildIndex(child)) << i;
+      EXPECT_EQ(children.size() - i, NthIndexCache::NthLastChildIndex(child))
+          << i;
+      EXPECT_EQ(of_type, NthIndexCache::NthOfTypeIndex(child)) << i;
+      EXPECT_EQ(of_type_count - of_type + 1,
+                NthIndexCache::NthLastOfTypeIndex(child))
+          << i;
+    }
+  }
+
+  Element* CreateSpan() {
+    return GetDocument().CreateRawElement(html_names::kSpanTag);
+  }
+
+  ScopedOrderedNthIndexCacheForTest ordered_nth_index_cache_{true};
+};
+
+TEST_F(OrderedNthIndexCacheTest, SurvivesAcrossScopes) {
+  ExpectIndices();
+  OrderedNthIndexCache* cache = GetDocument().GetOrderedNthIndexCache();
+  ASSERT_TRUE(cache);
+  EXPECT_EQ(2u, cache->CachedParentCountForTesting());
+
+  // No DOM changes, and the data is still there in a new scope.
+  NthIndexCache nth_index_cache(GetDocument());
+  ExpectIndices();
+  EXPECT_EQ(2u, cache->CachedParentCountForTesting());
+}
+
+TEST_F(OrderedNthIndexCacheTest, InsertionsAndRemovalsAtTheEnds) {
+  ExpectIndices();
+
+  Parent().insertBefore(CreateSpan(), Parent().firstChild());
+  ExpectIndices();
+  Parent().AppendChild(CreateSpan());
+  ExpectIndices();
+  Parent().firstElementChild()->remove();
+  ExpectIndices();
+  Parent().lastElementChild()->remove();
+  ExpectIndices();
+
+  // Scrolling a virtual list.
+  for (int i = 0; i < 10; ++i) {
+    Parent().firstElementChild()->remove();
+    Parent().AppendChild(CreateSpan());
+  }
+  ExpectIndices();
+  for (int i = 0; i < 10; ++i) {
+    Parent().lastElementChild()->remove();
+    Parent().insertBefore(CreateSpan(), Parent().firstChild());
+  }
+  ExpectIndices();
+}
+
+TEST_F(OrderedNthIndexCacheTest, InsertionsAndRemovalsInTheMiddle) {
+  ExpectIndices();
+
+  Element* middle = ElementTraversal::FirstChild(Parent());
+  for (int i = 0; i < 20; ++i)
+    middle = ElementTraversal::NextSibling(*middle);
+  Parent().insertBefore(CreateSpan(), middle);
+  ExpectIndices();
+
+  // Multiple mutations between lookups.
+  Parent().insertBefore(
+      GetDocument().CreateRawElement(html_names::kBTag), middle);
+  middle->nextElementSibling()->remove();
+  Parent().AppendChild(CreateSpan());
+  Parent().firstElementChild()->remove();
+  ExpectIndices();
+
+  middle->remove();
+  ExpectIndices();
+
+  // Multiple children inserted at once.
+  Parent().firstElementChild()->nextElementSibling()->setOuterHTML(
+      "<span></span><b></b><span></span>", ASSERT_NO_EXCEPTION);
+  ExpectIndices();
+  Parent().lastElementChild()->insertAdjacentHTML(
+      "afterend", "<b></b><span></span>", ASSERT_NO_EXCEPTION);
+  ExpectIndices();
+}
+
+TEST_F(OrderedNthIndexCacheTest, AllChildrenRemoved) {
+  ExpectIndices();
+  OrderedNthIndexCache* cache = GetDocument().GetOrderedNthIndexCache();
+  ASSERT_TRUE(cache);
+  EXPECT_EQ(2u, cache->CachedParentCountForTesting());
+
+  Parent().setInnerHTML("<span></span><span></span>");
+  EXPECT_EQ(0u, cache->CachedParentCountForTesting());
+  ExpectIndices();
+}
+
+TEST_F(OrderedNthIndexCacheTest, ParentsAreWeak) {
+  ExpectIndices();
+  OrderedNthIndexCache* cache = GetDocument().GetOrderedNthIndexCache();
+  ASSERT_TRUE(cache);
+  EXPECT_EQ(2u, cache->CachedParentCountForTesting());
+
+  Parent().remove();
+  ThreadState::Current()->CollectAllGarbageForTesting();
+  EXPECT_EQ(0u, cache->CachedParentCountForTesting());
+}
+
 }  // namespace blink
@@ -21,6 +21,8 @@
 #include "third_party/blink/renderer/core/html/nesting_level_incrementer.h"
 #include "third_party/blink/renderer/core/inspector/console_message.h"
 #include "third_party/blink/renderer/core/paint/paint_layer.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -225,6 +227,7 @@ SlotAssignment::SlotAssignment(ShadowRoot& owner)
 
 void SlotAssignment::SetNeedsAssignmentRecalc() {
   needs_assignment_recalc_ = true;
+  owner_->GetDocument().IncSlotAssignmentVersion();
   if (owner_->isConnected()) {
     owner_->GetDocument().GetSlotAssignmentEngine().AddShadowRootNeedingRecalc(
         *owner_);
@@ -232,10 +235,33 @@ void SlotAssignment::SetNeedsAssignmentRecalc() {
   }
 }
 
-void SlotAssignment::RecalcAssignment() {
+bool SlotAssignment::RecalcAssignment() {
   if (!needs_assignment_recalc_)
-    return;
-  {
+    return false;
+  bool recalculated = true;
+  bool assignment_unchanged = false;
+  if (RuntimeEnabledFeatures::SkipUnchangedSlotAssignmentRecalcEnabled() &&
+      !owner_->IsManualSlotting()) {
+    // HTMLSlotElement::AssignedNodes() recalcs a dirty assignment, so the
+    // dirty bit is cleared while the old assigned nodes are compared.
+    needs_assignment_recalc_ = false;
+    assignment_unchanged = IsAssignmentUnchanged();
+    needs_assignment_recalc_ = !assignment_unchanged;
+  }
+  if (assignment_unchanged) {
+    // Many mutations, like inserting a host child which doesn't match any
+    // slot, mark the assignment dirty without changing it. Then there are no
+    // assigned nodes to invalidate, and no flat tree node data to update.
+    recalculated = false;
+    if (owner_->isConnected()) {
+      owner_->GetDocument()
+          .GetSlotAssignmentEngine()
+          .RemoveShadowRootNeedingRecalc(*owner_);
+    }
+    // The fallback content of the slots without assigned nodes may have
+    // changed, which also marks the assignment dirty.
+    RecalcFallbackSlots();
+  } else {
     NestingLevelIncrementer slot_assignment_recalc_depth(
         owner_->GetDocument().SlotAssignmentRecalcDepth());
 
@@ -345,6 +371,68 @@ void SlotAssignment::RecalcAssignment() {
   // Resolve the directionality of elements deferred their adjustment.
   HTMLElement::AdjustCandidateDirectionalityForSlot(
       std::move(candidate_directionality_set_));
+  return recalculated;
+}
+
+void SlotAssignment::RecalcFallbackSlots() {
+  DCHECK(!needs_assignment_recalc_);
+  HeapVector<Member<HTMLSlotElement>> fallback_slots;
+  for (Member<HTMLSlotElement> slot : Slots()) {
+    if (slot->AssignedNodes().IsEmpty())
+      fallback_slots.push_back(slot);
+  }
+  if (fallback_slots.IsEmpty())
+    return;
+
+  NestingLevelIncrementer slot_assignment_recalc_depth(
+      owner_->GetDocument().SlotAssignmentRecalcDepth());
+  SlotAssignmentRecalcForbiddenScope forbid_slot_recalc(owner_->GetDocument());
+
+  // Like RecalcAssignment(), but only for the slots whose flat tree children
+  // are their fallback content.
+  if (AXObjectCache* cache = owner_->GetDocument().ExistingAXObjectCache()) {
+    for (Member<HTMLSlotElement> slot : fallback_slots)
+      cache->SlotAssignmentWillChange(slot);
+  }
+
+  FlatTreeTraversalForbiddenScope forbid_flat_tree_traversal(
+      owner_->GetDocument());
+
+  for (Member<HTMLSlotElement> slot : fallback_slots) {
+    slot->WillRecalcAssignedNodes();
+    slot->DidRecalcAssignedNodes(
+        !!DisplayLockUtilities::
+             LockedInclusiveAncestorPreventingStyleWithinTreeScope(*slot));
+  }
+}
+
+bool SlotAssignment::IsAssignmentUnchanged() {
+  DCHECK(!owner_->IsManualSlotting());
+  DCHECK(!needs_assignment_recalc_);
+  // The number of host children found so far for each slot, which is also
+  // the index of the next one in the assigned nodes of the slot.
+  HeapHashMap<Member<HTMLSlotElement>, wtf_size_t> assigned_counts;
+  for (Node& child : NodeTraversal::ChildrenOf(owner_->host())) {
+    if (!child.IsSlotable())
+      continue;
+    HTMLSlotElement* slot = FindSlotByName(child.SlotName());
+    if (slot != child.AssignedSlotWithoutRecalc())
+      return false;
+    if (!slot)
+      continue;
+    wtf_size_t& index = assigned_counts.insert(slot, 0).stored_value->value;
+    const HeapVector<Member<Node>>& assigned_nodes = slot->AssignedNodes();
+    if (index >= assigned_nodes.size() || assigned_nodes[index] != &child)
+      return false;
+    ++index;
+  }
+  for (HTMLSlotElement* slot : Slots()) {
+    auto it = assigned_counts.find(slot);
+    wtf_size_t count = it == assigned_counts.end() ? 0 : it->value;
+    if (slot->AssignedNodes().size() != count)
+      return false;
+  }
+  return true;
 }
 
 const HeapVector<Member<HTMLSlotElement>>& SlotAssignment::Slots() {
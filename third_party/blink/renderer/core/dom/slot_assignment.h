@@ -48,7 +48,9 @@ class SlotAssignment final : public GarbageCollected<SlotAssignment> {
 
   bool NeedsAssignmentRecalc() const { return needs_assignment_recalc_; }
   void SetNeedsAssignmentRecalc();
-  void RecalcAssignment();
+  // Returns false if the assigned nodes of the slots were not recalculated,
+  // because they would not have changed.
+  bool RecalcAssignment();
   HeapHashSet<Member<Node>>& GetCandidateDirectionality() {
     return candidate_directionality_set_;
   }
@@ -60,6 +62,10 @@ class SlotAssignment final : public GarbageCollected<SlotAssignment> {
   };
 
   HTMLSlotElement* FindSlotInManualSlotting(Node&);
+  bool IsAssignmentUnchanged();
+  // Recalculates the flat tree children of the slots without assigned nodes,
+  // when the assignment itself is unchanged.
+  void RecalcFallbackSlots();
 
   void CollectSlots();
   HTMLSlotElement* GetCachedFirstSlotWithoutAccessingNodeTree(
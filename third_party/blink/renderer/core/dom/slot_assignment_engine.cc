@@ -50,7 +50,8 @@ void SlotAssignmentEngine::RecalcSlotAssignments() {
     DCHECK(shadow_root->NeedsSlotAssignmentRecalc());
     // SlotAssignment::RecalcAssignment() will remove its shadow root from
     // shadow_roots_needing_recalc_.
-    shadow_root->GetSlotAssignment().RecalcAssignment();
+    if (!shadow_root->GetSlotAssignment().RecalcAssignment())
+      ++skipped_recalc_count_;
   }
   DCHECK(shadow_roots_needing_recalc_.IsEmpty());
 }
@@ -30,10 +30,17 @@ class CORE_EXPORT SlotAssignmentEngine final
 
   void RecalcSlotAssignments();
 
+  // The number of shadow roots which were marked for recalc, but whose slot
+  // assignment turned out to be unchanged.
+  unsigned SkippedRecalcCountForTesting() const {
+    return skipped_recalc_count_;
+  }
+
   void Trace(Visitor*) const;
 
  private:
   HeapHashSet<WeakMember<ShadowRoot>> shadow_roots_needing_recalc_;
+  unsigned skipped_recalc_count_ = 0;
 };
 
 }  // namespace blink
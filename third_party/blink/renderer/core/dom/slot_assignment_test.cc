@@ -10,6 +10,7 @@
 #include "third_party/blink/renderer/core/dom/node.h"
 #include "third_party/blink/renderer/core/dom/node_traversal.h"
 #include "third_party/blink/renderer/core/dom/shadow_root.h"
+#include "third_party/blink/renderer/core/dom/slot_assignment_engine.h"
 #include "third_party/blink/renderer/core/dom/text.h"
 #include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/html/html_collection.h"
@@ -129,6 +130,128 @@ TEST_F(SlotAssignmentTest, AssignedNodesAreSet) {
   EXPECT_EQ(expected_nodes, slot->AssignedNodes());
 }
 
+TEST_F(SlotAssignmentTest, SkipUnchangedRecalc) {
+  ScopedSkipUnchangedSlotAssignmentRecalcForTest skip_unchanged_recalc(true);
+  SetBody(R"HTML(
+    <div id=host>
+      <template shadowroot=open>
+        <slot name=a></slot>
+        <slot id=b name=b></slot>
+      </template>
+      <span id=a slot=a></span>
+    </div>
+  )HTML");
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+
+  Element* host = GetDocument().QuerySelector("#host");
+  Element* child_a = GetDocument().QuerySelector("#a");
+  ShadowRoot* shadow_root = host->OpenShadowRoot();
+  auto* slot_a = To<HTMLSlotElement>(shadow_root->QuerySelector("slot"));
+  SlotAssignmentEngine& engine = GetDocument().GetSlotAssignmentEngine();
+  unsigned skipped_count = engine.SkippedRecalcCountForTesting();
+
+  // A child without a matching slot does not change the assignment.
+  auto* unslotted = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+  unslotted->setAttribute(html_names::kSlotAttr, "c");
+  host->appendChild(unslotted);
+  EXPECT_TRUE(engine.HasPendingSlotAssignmentRecalc());
+  engine.RecalcSlotAssignments();
+  EXPECT_EQ(++skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_EQ(nullptr, unslotted->AssignedSlot());
+  HeapVector<Member<Node>> expected_nodes;
+  expected_nodes.push_back(child_a);
+  EXPECT_EQ(expected_nodes, slot_a->AssignedNodes());
+
+  // A child for an existing slot does.
+  auto* slotted = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+  slotted->setAttribute(html_names::kSlotAttr, "a");
+  host->appendChild(slotted);
+  engine.RecalcSlotAssignments();
+  EXPECT_EQ(skipped_count, engine.SkippedRecalcCountForTesting());
+  expected_nodes.push_back(slotted);
+  EXPECT_EQ(expected_nodes, slot_a->AssignedNodes());
+
+  // So do the removal of a slot and the renaming of a child.
+  slot_a->remove();
+  engine.RecalcSlotAssignments();
+  EXPECT_EQ(skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_EQ(nullptr, child_a->AssignedSlot());
+  child_a->setAttribute(html_names::kSlotAttr, "b");
+  engine.RecalcSlotAssignments();
+  EXPECT_EQ(skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_EQ(shadow_root->getElementById("b"), child_a->AssignedSlot());
+
+  {
+    ScopedSkipUnchangedSlotAssignmentRecalcForTest disabled(false);
+    unslotted->remove();
+    engine.RecalcSlotAssignments();
+    EXPECT_EQ(skipped_count, engine.SkippedRecalcCountForTesting());
+  }
+}
+
+TEST_F(SlotAssignmentTest, SkipUnchangedRecalcUpdatesFallback) {
+  ScopedSkipUnchangedSlotAssignmentRecalcForTest skip_unchanged_recalc(true);
+  SetBody(R"HTML(
+    <div id=host>
+      <template shadowroot=open>
+        <slot name=a></slot>
+      </template>
+      <span id=a slot=a></span>
+    </div>
+  )HTML");
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+
+  Element* host = GetDocument().QuerySelector("#host");
+  ShadowRoot* shadow_root = host->OpenShadowRoot();
+  SlotAssignmentEngine& engine = GetDocument().GetSlotAssignmentEngine();
+  unsigned skipped_count = engine.SkippedRecalcCountForTesting();
+
+  // A slot which only has fallback content does not change the assignment.
+  auto* slot_b = MakeGarbageCollected<HTMLSlotElement>(GetDocument());
+  slot_b->setAttribute(html_names::kNameAttr, "b");
+  auto* fallback = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+  slot_b->appendChild(fallback);
+  shadow_root->appendChild(slot_b);
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(++skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_TRUE(slot_b->AssignedNodes().IsEmpty());
+  EXPECT_TRUE(fallback->GetLayoutObject());
+
+  // Neither does an edit of the fallback content, but the new fallback
+  // content is still in the flat tree children of the slot.
+  auto* added_fallback = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+  slot_b->appendChild(added_fallback);
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(++skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_EQ(2u, FlatTreeTraversal::CountChildren(*slot_b));
+  EXPECT_EQ(added_fallback, FlatTreeTraversal::LastChild(*slot_b));
+  EXPECT_TRUE(added_fallback->GetLayoutObject());
+
+  // A host child for the slot replaces all of its fallback content.
+  auto* slotted = MakeGarbageCollected<HTMLDivElement>(GetDocument());
+  slotted->setAttribute(html_names::kSlotAttr, "b");
+  host->appendChild(slotted);
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(skipped_count, engine.SkippedRecalcCountForTesting());
+  EXPECT_EQ(slot_b, slotted->AssignedSlot());
+  EXPECT_EQ(1u, FlatTreeTraversal::CountChildren(*slot_b));
+  EXPECT_EQ(slotted, FlatTreeTraversal::FirstChild(*slot_b));
+  EXPECT_EQ(slot_b, FlatTreeTraversal::Parent(*slotted));
+  EXPECT_FALSE(FlatTreeTraversal::Parent(*fallback));
+  EXPECT_FALSE(FlatTreeTraversal::Parent(*added_fallback));
+  EXPECT_TRUE(slotted->GetLayoutObject());
+  EXPECT_FALSE(fallback->GetLayoutObject());
+  EXPECT_FALSE(added_fallback->GetLayoutObject());
+
+  // Removing the host child brings the fallback content back.
+  slotted->remove();
+  GetDocument().View()->UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(2u, FlatTreeTraversal::CountChildren(*slot_b));
+  EXPECT_EQ(fallback, FlatTreeTraversal::FirstChild(*slot_b));
+  EXPECT_TRUE(fallback->GetLayoutObject());
+  EXPECT_TRUE(added_fallback->GetLayoutObject());
+}
+
 TEST_F(SlotAssignmentTest, ScheduleVisualUpdate) {
   SetBody(R"HTML(
     <div id="host">
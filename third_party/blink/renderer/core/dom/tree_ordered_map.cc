@@ -31,6 +31,8 @@
 
 #include "third_party/blink/renderer/core/dom/tree_ordered_map.h"
 
+#include <algorithm>
+
 #include "third_party/blink/renderer/core/dom/element.h"
 #include "third_party/blink/renderer/core/dom/element_traversal.h"
 #include "third_party/blink/renderer/core/dom/tree_scope.h"
@@ -38,6 +40,7 @@
 #include "third_party/blink/renderer/core/html/html_slot_element.h"
 #include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -81,11 +84,52 @@ void TreeOrderedMap::Add(const AtomicString& key, Element& element) {
 
   Member<MapEntry>& entry = add_result.stored_value->value;
   DCHECK(entry->count);
+  if (RuntimeEnabledFeatures::IncrementalTreeOrderedMapEnabled()) {
+    if (entry->ordered_list.IsEmpty() && entry->count == 1 && entry->element)
+      entry->ordered_list.push_back(entry->element);
+    if (entry->ordered_list.size() == entry->count &&
+        entry->InsertInTreeOrder(element)) {
+      entry->element = entry->ordered_list.front();
+      entry->count++;
+      return;
+    }
+  }
   entry->element = nullptr;
   entry->count++;
   entry->ordered_list.clear();
 }
 
+bool TreeOrderedMap::MapEntry::InsertInTreeOrder(Element& new_element) {
+  DCHECK(!ordered_list.IsEmpty());
+  // The elements of a subtree which is being removed are removed from the map
+  // one at a time, after the whole subtree was removed from the tree.
+  bool disconnected = false;
+  auto is_before = [&disconnected](const Member<Element>& a,
+                                   const Member<Element>& b) {
+    unsigned short position = a->compareDocumentPosition(b);
+    if (position & Node::kDocumentPositionDisconnected)
+      disconnected = true;
+    return position & Node::kDocumentPositionFollowing;
+  };
+  // Elements with the same key are often added in tree order, e.g. by the
+  // parser, or for the repeated items of a list.
+  Member<Element> member(&new_element);
+  bool is_last = is_before(ordered_list.back(), member);
+  if (disconnected)
+    return false;
+  if (is_last) {
+    ordered_list.push_back(member);
+    return true;
+  }
+  auto* position = std::upper_bound(ordered_list.begin(), ordered_list.end(),
+                                    member, is_before);
+  if (disconnected)
+    return false;
+  ordered_list.insert(static_cast<wtf_size_t>(position - ordered_list.begin()),
+                      member);
+  return true;
+}
+
 void TreeOrderedMap::Remove(const AtomicString& key, Element& element) {
   DCHECK(key);
 
@@ -98,16 +142,31 @@ void TreeOrderedMap::Remove(const AtomicString& key, Element& element) {
   if (entry->count == 1) {
     DCHECK(!entry->element || entry->element == element);
     map_.erase(it);
-  } else {
-    if (entry->element == element) {
-      DCHECK(entry->ordered_list.IsEmpty() ||
-             entry->ordered_list.front() == element);
-      entry->element =
-          entry->ordered_list.size() > 1 ? entry->ordered_list[1] : nullptr;
+    return;
+  }
+
+  if (RuntimeEnabledFeatures::IncrementalTreeOrderedMapEnabled() &&
+      entry->ordered_list.size() == entry->count) {
+    wtf_size_t index = entry->ordered_list.Find(&element);
+    if (index != kNotFound) {
+      entry->ordered_list.EraseAt(index);
+      entry->count--;
+      // The next element may be in a subtree which is being removed, so Get()
+      // checks it before caching it.
+      if (entry->element == element)
+        entry->element = nullptr;
+      return;
     }
-    entry->count--;
-    entry->ordered_list.clear();
   }
+
+  if (entry->element == element) {
+    DCHECK(entry->ordered_list.IsEmpty() ||
+           entry->ordered_list.front() == element);
+    entry->element =
+        entry->ordered_list.size() > 1 ? entry->ordered_list[1] : nullptr;
+  }
+  entry->count--;
+  entry->ordered_list.clear();
 }
 
 template <bool keyMatches(const AtomicString&, const Element&)>
@@ -123,6 +182,17 @@ inline Element* TreeOrderedMap::Get(const AtomicString& key,
   if (entry->element)
     return entry->element;
 
+  if (!entry->ordered_list.IsEmpty()) {
+    DCHECK_EQ(entry->ordered_list.size(), entry->count);
+    // The first element is only missing from the tree if it is in a subtree
+    // which is being removed. The map is notified of those one at a time.
+    Element* first = entry->ordered_list.front();
+    if (first->IsDescendantOf(&scope.RootNode())) {
+      entry->element = first;
+      return first;
+    }
+  }
+
   // Iterate to find the node that matches. Nothing will match iff an element
   // with children having duplicate IDs is being removed -- the tree traversal
   // will be over an updated tree not having that subtree. In all other cases,
@@ -53,7 +53,8 @@ class TreeScope;
 // per key, maintained in tree order per key. Tree walks are avoided when
 // possible by retaining a cached, ordered array of matching nodes. Adding or
 // removing an element for a given key often clears the cache, forcing a tree
-// walk upon the next access.
+// walk upon the next access. With IncrementalTreeOrderedMap, the array is kept
+// up to date instead, by inserting added elements with a binary search.
 class CORE_EXPORT TreeOrderedMap : public GarbageCollected<TreeOrderedMap> {
  public:
   TreeOrderedMap();
@@ -109,8 +110,14 @@ class CORE_EXPORT TreeOrderedMap : public GarbageCollected<TreeOrderedMap> {
 
     void Trace(Visitor*) const;
 
+    // Inserts |new_element| into |ordered_list|, which must contain all the
+    // other elements. Returns false if their order can't be determined.
+    bool InsertInTreeOrder(Element& new_element);
+
     Member<Element> element;
     unsigned count;
+    // Empty unless it was built by GetAllElementsById(), or it is kept up to
+    // date because of IncrementalTreeOrderedMap.
     HeapVector<Member<Element>> ordered_list;
   };
 
@@ -11,6 +11,7 @@
 #include "third_party/blink/renderer/core/html/html_div_element.h"
 #include "third_party/blink/renderer/core/html/html_slot_element.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -140,4 +141,62 @@ TEST_F(TreeOrderedMapTest, RemovedDuplicateKeys) {
       << "The call to GetSlotByName should have cleared the key entirely";
 }
 
+TEST_F(TreeOrderedMapTest, IncrementalDuplicateKeys) {
+  ScopedIncrementalTreeOrderedMapForTest incremental_tree_ordered_map(true);
+  auto* map = MakeGarbageCollected<TreeOrderedMap>();
+  AtomicString key = "test";
+  auto& element1 = *AddElement(key);
+  auto& element2 = *AddElement(key);
+  auto& element3 = *AddElement(key);
+  map->Add(key, element2);
+  map->Add(key, element3);
+  map->Add(key, element1);
+  EXPECT_TRUE(map->ContainsMultiple(key));
+  EXPECT_EQ(map->GetCachedFirstElementWithoutAccessingNodeTree(key), element1)
+      << "No tree walk needed";
+  HeapVector<Member<Element>> expected;
+  expected.push_back(&element1);
+  expected.push_back(&element2);
+  expected.push_back(&element3);
+  EXPECT_EQ(map->GetAllElementsById(key, GetTreeScope()), expected);
+
+  element1.remove();
+  map->Remove(key, element1);
+  EXPECT_EQ(map->GetSlotByName(key, GetTreeScope()), element2);
+  element3.remove();
+  map->Remove(key, element3);
+  EXPECT_FALSE(map->ContainsMultiple(key));
+  EXPECT_EQ(map->GetSlotByName(key, GetTreeScope()), element2);
+  expected.clear();
+  expected.push_back(&element2);
+  EXPECT_EQ(map->GetAllElementsById(key, GetTreeScope()), expected);
+
+  // Adding an element before the first one updates the cached first element.
+  element2.parentNode()->insertBefore(&element1, &element2);
+  map->Add(key, element1);
+  EXPECT_EQ(map->GetCachedFirstElementWithoutAccessingNodeTree(key), element1);
+  map->Remove(key, element2);
+  map->Remove(key, element1);
+  EXPECT_FALSE(map->Contains(key));
+}
+
+TEST_F(TreeOrderedMapTest, IncrementalRemovedDuplicateKeys) {
+  ScopedIncrementalTreeOrderedMapForTest incremental_tree_ordered_map(true);
+  auto* map = MakeGarbageCollected<TreeOrderedMap>();
+  AtomicString key = "test";
+  auto& outer = *AddElement(key);
+  auto& inner = *AddElement(key);
+  outer.appendChild(&inner);
+  map->Add(key, outer);
+  map->Add(key, inner);
+  EXPECT_EQ(map->GetSlotByName(key, GetTreeScope()), outer);
+  outer.remove();  // This removes both elements from the tree
+  TreeOrderedMap::RemoveScope tree_remove_scope;
+  map->Remove(key, outer);
+  EXPECT_TRUE(map->Contains(key));
+  EXPECT_EQ(map->GetSlotByName(key, GetTreeScope()), nullptr)
+      << "inner is not returned, as it is not in the tree scope anymore";
+  EXPECT_FALSE(map->Contains(key));
+}
+
 }  // namespace blink
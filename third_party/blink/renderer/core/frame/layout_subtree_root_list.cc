@@ -19,6 +19,12 @@ LayoutObject* LayoutSubtreeRootList::RandomRoot() {
   return *Unordered().begin();
 }
 
+bool LayoutSubtreeRootList::IsIndependentContainmentRoot(
+    const LayoutObject& object) {
+  return object.ShouldApplySizeContainment() &&
+         object.ShouldApplyLayoutContainment();
+}
+
 void LayoutSubtreeRootList::CountObjectsNeedingLayoutInRoot(
     const LayoutObject* object,
     unsigned& needs_layout_objects,
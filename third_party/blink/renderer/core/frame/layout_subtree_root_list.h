@@ -36,6 +36,12 @@ class LayoutSubtreeRootList : public DepthOrderedLayoutObjectList {
   // for a layout crbug.com/460596
   LayoutObject* RandomRoot();
 
+  // Returns true if |object| applies both size and layout containment. Laying
+  // it out can neither change its size nor move anything outside of it, so
+  // such roots can't affect each other, nor the scroll anchors of the frame
+  // outside of them.
+  static bool IsIndependentContainmentRoot(const LayoutObject& object);
+
   void CountObjectsNeedingLayout(unsigned& needs_layout_objects,
                                  unsigned& total_objects);
 
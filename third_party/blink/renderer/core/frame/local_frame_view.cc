@@ -123,6 +123,7 @@
 #include "third_party/blink/renderer/core/layout/svg/layout_svg_root.h"
 #include "third_party/blink/renderer/core/layout/text_autosizer.h"
 #include "third_party/blink/renderer/core/layout/traced_layout_object.h"
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
 #include "third_party/blink/renderer/core/loader/document_loader.h"
 #include "third_party/blink/renderer/core/loader/frame_loader.h"
 #include "third_party/blink/renderer/core/media_type_names.h"
@@ -264,6 +265,7 @@ LocalFrameView::LocalFrameView(LocalFrame& frame, gfx::Rect frame_rect)
       layout_scheduling_enabled_(true),
       layout_count_for_testing_(0),
       lifecycle_update_count_for_testing_(0),
+      scroll_anchor_notification_count_for_testing_(0),
       // We want plugin updates to happen in FIFO order with loading tasks.
       update_plugins_timer_(frame.GetTaskRunner(TaskType::kInternalLoading),
                             this,
@@ -292,6 +294,8 @@ LocalFrameView::LocalFrameView(LocalFrame& frame, gfx::Rect frame_rect)
       paint_frame_count_(0),
       unique_id_(NewUniqueObjectId()),
       layout_shift_tracker_(MakeGarbageCollected<LayoutShiftTracker>(this)),
+      visual_rect_mapping_cache_(
+          MakeGarbageCollected<VisualRectMappingCache>()),
       paint_timing_detector_(MakeGarbageCollected<PaintTimingDetector>(this)),
       mobile_friendliness_checker_(MobileFriendlinessChecker::Create(*this))
 #if DCHECK_IS_ON()
@@ -331,6 +335,7 @@ void LocalFrameView::Trace(Visitor* visitor) const {
   visitor->Trace(anchoring_adjustment_queue_);
   visitor->Trace(scroll_event_queue_);
   visitor->Trace(layout_shift_tracker_);
+  visitor->Trace(visual_rect_mapping_cache_);
   visitor->Trace(paint_timing_detector_);
   visitor->Trace(mobile_friendliness_checker_);
   visitor->Trace(lifecycle_observers_);
@@ -631,7 +636,8 @@ void LocalFrameView::CountObjectsNeedingLayout(unsigned& needs_layout_objects,
   }
 }
 
-bool LocalFrameView::LayoutFromRootObject(LayoutObject& root) {
+bool LocalFrameView::LayoutFromRootObject(LayoutObject& root,
+                                          bool notify_scroll_anchors) {
   if (!root.NeedsLayout())
     return false;
 
@@ -655,11 +661,13 @@ bool LocalFrameView::LayoutFromRootObject(LayoutObject& root) {
   }
 
   LayoutState layout_state(root);
-  if (scroll_anchoring_scrollable_areas_) {
+  if (notify_scroll_anchors && scroll_anchoring_scrollable_areas_) {
     for (auto& scrollable_area : *scroll_anchoring_scrollable_areas_) {
       if (scrollable_area->GetScrollAnchor() &&
-          scrollable_area->ShouldPerformScrollAnchoring())
+          scrollable_area->ShouldPerformScrollAnchoring()) {
         scrollable_area->GetScrollAnchor()->NotifyBeforeLayout();
+        scroll_anchor_notification_count_for_testing_++;
+      }
     }
   }
 
@@ -795,6 +803,14 @@ void LocalFrameView::PerformLayout() {
           ++add_result.stored_value->value;
         }
       }
+      // Every scroll anchor of the frame is notified before each root is laid
+      // out, which adds up for pages with many roots and scrollers, such as
+      // dashboards of contained widgets. An independent containment root
+      // cannot shift content outside of it, so the notification before the
+      // first of consecutive independent roots also holds for the others.
+      const bool skip_repeated_notifications =
+          RuntimeEnabledFeatures::SkipRepeatedScrollAnchorNotificationsEnabled();
+      bool after_independent_root = false;
       for (auto& root : layout_subtree_root_list_.Ordered()) {
         bool should_rebuild_fragments = false;
         LayoutObject& root_layout_object = *root;
@@ -808,8 +824,14 @@ void LocalFrameView::PerformLayout() {
               it != fragment_tree_spines.end() && --it->value == 0;
         }
 
-        if (!LayoutFromRootObject(*root))
+        bool is_independent_root =
+            skip_repeated_notifications &&
+            LayoutSubtreeRootList::IsIndependentContainmentRoot(*root);
+        if (!LayoutFromRootObject(
+                *root, !is_independent_root || !after_independent_root)) {
           continue;
+        }
+        after_independent_root = is_independent_root;
 
         if (should_rebuild_fragments)
           cb->RebuildFragmentTreeSpine();
@@ -1838,6 +1860,9 @@ void LocalFrameView::PerformPostLayoutTasks(bool visual_viewport_size_changed) {
   TRACE_EVENT_OBJECT_SNAPSHOT_WITH_ID(
       TRACE_DISABLED_BY_DEFAULT("blink.debug.layout.trees"), "LayoutTree", this,
       TracedLayoutObject::Create(*GetLayoutView(), true));
+  TRACE_EVENT_OBJECT_SNAPSHOT_WITH_ID(
+      TRACE_DISABLED_BY_DEFAULT("blink.debug.layout.trees"), "LayoutTreeMemory",
+      this, TracedLayoutObject::CreateMemoryStats(*GetLayoutView()));
   layout_count_for_testing_++;
   Document* document = GetFrame().GetDocument();
   DCHECK(document);
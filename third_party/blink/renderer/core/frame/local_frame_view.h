@@ -115,6 +115,7 @@ class Scrollbar;
 class ScrollingCoordinator;
 class TransformState;
 class LocalFrameUkmAggregator;
+class VisualRectMappingCache;
 class WebPluginContainerImpl;
 struct AnnotatedRegionValue;
 struct IntrinsicSizingInfo;
@@ -202,6 +203,9 @@ class CORE_EXPORT LocalFrameView final
   unsigned LifecycleUpdateCountForTesting() const {
     return lifecycle_update_count_for_testing_;
   }
+  unsigned ScrollAnchorNotificationCountForTesting() const {
+    return scroll_anchor_notification_count_for_testing_;
+  }
 
   void CountObjectsNeedingLayout(unsigned& needs_layout_objects,
                                  unsigned& total_objects,
@@ -702,6 +706,12 @@ class CORE_EXPORT LocalFrameView final
   cc::AnimationTimeline* GetScrollAnimationTimeline() const;
 
   LayoutShiftTracker& GetLayoutShiftTracker() { return *layout_shift_tracker_; }
+  // The cached results of LayoutObject::MapToVisualRectInAncestorSpace() for
+  // the layout objects of this frame. Cleared when the paint properties of
+  // the frame may change.
+  VisualRectMappingCache& GetVisualRectMappingCache() {
+    return *visual_rect_mapping_cache_;
+  }
   PaintTimingDetector& GetPaintTimingDetector() const {
     return *paint_timing_detector_;
   }
@@ -987,7 +997,11 @@ class CORE_EXPORT LocalFrameView final
 
   // Returns true if the root object was laid out. Returns false if the layout
   // was prevented (e.g. by ancestor display-lock) or not needed.
-  bool LayoutFromRootObject(LayoutObject& root);
+  // |notify_scroll_anchors| may be false if the scroll anchors have already
+  // been notified, and only independent containment roots have been laid out
+  // since.
+  bool LayoutFromRootObject(LayoutObject& root,
+                            bool notify_scroll_anchors = true);
 
   // Returns true if the value of layer_debug_info_enabled_ changed.
   bool UpdateLayerDebugInfoEnabled();
@@ -1033,6 +1047,7 @@ class CORE_EXPORT LocalFrameView final
   bool layout_scheduling_enabled_;
   unsigned layout_count_for_testing_;
   unsigned lifecycle_update_count_for_testing_;
+  unsigned scroll_anchor_notification_count_for_testing_;
   HeapTaskRunnerTimer<LocalFrameView> update_plugins_timer_;
 
   bool first_layout_;
@@ -1151,6 +1166,7 @@ class CORE_EXPORT LocalFrameView final
 
   UniqueObjectId unique_id_;
   Member<LayoutShiftTracker> layout_shift_tracker_;
+  Member<VisualRectMappingCache> visual_rect_mapping_cache_;
   Member<PaintTimingDetector> paint_timing_detector_;
 
   // Non-null in the outermost main frame of an ordinary page only.
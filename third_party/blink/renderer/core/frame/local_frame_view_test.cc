@@ -25,6 +25,7 @@
 #include "third_party/blink/renderer/core/testing/sim/sim_request.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_test.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_artifact.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
 #include "ui/gfx/geometry/size.h"
 
@@ -454,6 +455,128 @@ TEST_F(LocalFrameViewTest, IsUpdatingLifecycle) {
   GetFrame().View()->SetTargetStateForTest(DocumentLifecycle::kUninitialized);
 }
 
+TEST_F(LocalFrameViewTest, SkipRepeatedScrollAnchorNotifications) {
+  ScopedSkipRepeatedScrollAnchorNotificationsForTest skip_notifications(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      .widget { contain: strict; width: 100px; height: 100px; }
+    </style>
+    <div id="widget1" class="widget"><div id="content1"></div></div>
+    <div id="widget2" class="widget"><div id="content2"></div></div>
+    <div id="widget3" style="contain: layout"><div id="content3"></div></div>
+  )HTML");
+  const auto* widget1 = GetLayoutObjectByElementId("widget1");
+  const auto* widget2 = GetLayoutObjectByElementId("widget2");
+  EXPECT_TRUE(LayoutSubtreeRootList::IsIndependentContainmentRoot(*widget1));
+  EXPECT_TRUE(LayoutSubtreeRootList::IsIndependentContainmentRoot(*widget2));
+  EXPECT_FALSE(LayoutSubtreeRootList::IsIndependentContainmentRoot(
+      *GetLayoutObjectByElementId("widget3")));
+
+  GetElementById("content1")->setInnerHTML("a<br>b", ASSERT_NO_EXCEPTION);
+  GetElementById("content2")->setInnerHTML("c", ASSERT_NO_EXCEPTION);
+  GetDocument().UpdateStyleAndLayoutTree();
+  EXPECT_TRUE(GetFrame().View()->IsSubtreeLayout());
+  UpdateAllLifecyclePhasesForTest();
+
+  EXPECT_FALSE(widget1->NeedsLayout());
+  EXPECT_FALSE(widget2->NeedsLayout());
+  const auto* content1 = To<LayoutBox>(GetLayoutObjectByElementId("content1"));
+  const auto* content2 = To<LayoutBox>(GetLayoutObjectByElementId("content2"));
+  EXPECT_GT(content1->LogicalHeight(), content2->LogicalHeight());
+  EXPECT_EQ(LayoutUnit(100), To<LayoutBox>(widget1)->LogicalHeight());
+}
+
+TEST_F(LocalFrameViewTest, SkipRepeatedScrollAnchorNotificationsCount) {
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      .widget { contain: strict; width: 100px; height: 100px; overflow: auto; }
+      .item { height: 50px; }
+    </style>
+    <div id="widget1" class="widget">
+      <div id="item1" class="item"></div><div style="height: 300px"></div>
+    </div>
+    <div id="widget2" class="widget">
+      <div id="item2" class="item"></div><div style="height: 300px"></div>
+    </div>
+    <div>
+      <div id="widget3" class="widget" style="contain: layout">
+        <div id="item3" class="item"></div><div style="height: 300px"></div>
+      </div>
+    </div>
+  )HTML");
+  LocalFrameView& view = *GetFrame().View();
+  ASSERT_TRUE(view.ScrollAnchoringScrollableAreas());
+  const unsigned num_scrollers = view.ScrollAnchoringScrollableAreas()->size();
+  EXPECT_LE(3u, num_scrollers);
+
+  auto update_items = [&](const char* height) {
+    for (const char* id : {"item1", "item2", "item3"}) {
+      GetElementById(id)->setAttribute(html_names::kStyleAttr,
+                                       AtomicString(height));
+    }
+    GetDocument().UpdateStyleAndLayoutTree();
+    EXPECT_TRUE(view.IsSubtreeLayout());
+    unsigned notifications = view.ScrollAnchorNotificationCountForTesting();
+    UpdateAllLifecyclePhasesForTest();
+    return view.ScrollAnchorNotificationCountForTesting() - notifications;
+  };
+
+  // widget3 is deeper, so it is laid out after the other roots. Each of the
+  // three roots notifies every scroll anchor of the frame.
+  {
+    ScopedSkipRepeatedScrollAnchorNotificationsForTest skip_notifications(
+        false);
+    EXPECT_EQ(3 * num_scrollers, update_items("height: 60px"));
+  }
+  // The notification before widget1 also holds for widget2, but not for
+  // widget3, which may change its size.
+  {
+    ScopedSkipRepeatedScrollAnchorNotificationsForTest skip_notifications(
+        true);
+    EXPECT_EQ(2 * num_scrollers, update_items("height: 70px"));
+  }
+}
+
+TEST_F(LocalFrameViewTest,
+       SkipRepeatedScrollAnchorNotificationsAnchorInLaterRoot) {
+  ScopedSkipRepeatedScrollAnchorNotificationsForTest skip_notifications(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      .widget { contain: strict; width: 100px; height: 100px; overflow: auto; }
+      .item { height: 50px; }
+    </style>
+    <div id="widget1" class="widget">
+      <div id="item1" class="item"></div><div style="height: 300px"></div>
+    </div>
+    <div>
+      <div id="widget2" class="widget">
+        <div id="item2" class="item"></div><div style="height: 300px"></div>
+      </div>
+    </div>
+  )HTML");
+  Element* widget1 = GetElementById("widget1");
+  Element* widget2 = GetElementById("widget2");
+  widget2->setScrollTop(100);
+  UpdateAllLifecyclePhasesForTest();
+
+  // widget2 is deeper, so it is laid out after widget1. Its anchor is only
+  // notified before widget1 is laid out, but still keeps the content of
+  // widget2 in place when the item above it grows.
+  GetElementById("item1")->setAttribute(html_names::kStyleAttr,
+                                        "height: 80px");
+  GetElementById("item2")->setAttribute(html_names::kStyleAttr,
+                                        "height: 80px");
+  GetDocument().UpdateStyleAndLayoutTree();
+  EXPECT_TRUE(GetFrame().View()->IsSubtreeLayout());
+  unsigned notifications =
+      GetFrame().View()->ScrollAnchorNotificationCountForTesting();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_GT(GetFrame().View()->ScrollAnchorNotificationCountForTesting(),
+            notifications);
+  EXPECT_EQ(0, widget1->scrollTop());
+  EXPECT_EQ(130, widget2->scrollTop());
+}
+
 TEST_F(LocalFrameViewSimTest, PaintEligibilityNoSubframe) {
   SimRequest resource("https://example.com/", "text/html");
 
@@ -7,6 +7,7 @@
 #include "third_party/blink/renderer/core/layout/api/line_layout_block_flow.h"
 #include "third_party/blink/renderer/core/layout/layout_multi_column_flow_thread.h"
 #include "third_party/blink/renderer/core/layout/layout_multi_column_set.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -146,11 +147,20 @@ InitialColumnHeightFinder::InitialColumnHeightFinder(
     LayoutUnit logical_bottom_in_flow_thread)
     : ColumnBalancer(column_set,
                      logical_top_in_flow_thread,
-                     logical_bottom_in_flow_thread) {
+                     logical_bottom_in_flow_thread),
+      can_bisect_(RuntimeEnabledFeatures::BisectedColumnBalancingEnabled() &&
+                  !column_set.MultiColumnFlowThread()
+                       ->EnclosingFragmentationContext()) {
   shortest_struts_.resize(column_set.UsedColumnCount());
   for (auto& strut : shortest_struts_)
     strut = LayoutUnit::Max();
   Traverse();
+  // Forced breaks are handled by the content runs below, and bisecting each
+  // run separately isn't worth it.
+  if (!content_runs_.IsEmpty()) {
+    can_bisect_ = false;
+    unbreakable_pieces_.clear();
+  }
   // We have now found each explicit / forced break, and their location. Now we
   // need to figure out how many additional implicit / soft breaks we need and
   // guess where they will occur, in order
@@ -181,8 +191,12 @@ LayoutUnit InitialColumnHeightFinder::InitialMinimalBalancedHeight() const {
   LayoutUnit start_offset = index > 0 ? content_runs_[index - 1].BreakOffset()
                                       : LogicalTopInFlowThread();
   LayoutUnit height = content_runs_[index].ColumnLogicalHeight(start_offset);
-  return row_logical_top +
-         std::max(height, tallest_unbreakable_logical_height_);
+  height = std::max(height, tallest_unbreakable_logical_height_);
+  if (can_bisect_) {
+    DCHECK(!row_logical_top);
+    height = BisectedBalancedHeight(height);
+  }
+  return row_logical_top + height;
 }
 
 void InitialColumnHeightFinder::ExamineBoxAfterEntering(
@@ -205,6 +219,18 @@ void InitialColumnHeightFinder::ExamineBoxAfterEntering(
     }
   }
 
+  if (can_bisect_) {
+    auto* block_flow = DynamicTo<LayoutBlockFlow>(box);
+    if (box.IsFloating() || box.PaginationStrut() ||
+        (block_flow && block_flow->MultiColumnFlowThread())) {
+      can_bisect_ = false;
+      unbreakable_pieces_.clear();
+    } else if (box.GetLegacyPaginationBreakability() ==
+               LayoutBox::kForbidBreaks) {
+      RecordUnbreakablePiece(FlowThreadOffset(), child_logical_height);
+    }
+  }
+
   if (box.GetLegacyPaginationBreakability() != LayoutBox::kAllowAnyBreaks) {
     tallest_unbreakable_logical_height_ =
         std::max(tallest_unbreakable_logical_height_, child_logical_height);
@@ -259,6 +285,15 @@ void InitialColumnHeightFinder::ExamineLine(const RootInlineBox& line) {
     minimum_logial_height += line_top_in_flow_thread;
   tallest_unbreakable_logical_height_ =
       std::max(tallest_unbreakable_logical_height_, minimum_logial_height);
+  if (can_bisect_) {
+    if (line.PaginationStrut()) {
+      can_bisect_ = false;
+      unbreakable_pieces_.clear();
+    } else {
+      RecordUnbreakablePiece(line_top_in_flow_thread,
+                             line.LineBottomWithLeading() - line_top);
+    }
+  }
   if (IsFirstAfterBreak(line_top_in_flow_thread) &&
       last_break_seen_ != line_top_in_flow_thread) {
     last_break_seen_ = line_top_in_flow_thread;
@@ -280,6 +315,70 @@ void InitialColumnHeightFinder::RecordStrutBeforeOffset(
   shortest_struts_[index] = std::min(shortest_struts_[index], strut);
 }
 
+void InitialColumnHeightFinder::RecordUnbreakablePiece(
+    LayoutUnit logical_top_in_flow_thread,
+    LayoutUnit logical_height) {
+  DCHECK(can_bisect_);
+  LayoutUnit logical_bottom_in_flow_thread =
+      logical_top_in_flow_thread + logical_height;
+  logical_top_in_flow_thread =
+      std::max(logical_top_in_flow_thread, LogicalTopInFlowThread());
+  if (!unbreakable_pieces_.IsEmpty() &&
+      logical_top_in_flow_thread < unbreakable_pieces_.back().logical_top) {
+    // We have moved backwards, so this is a parallel flow, e.g. sibling table
+    // cells. We cannot tell where the breaks would go then.
+    can_bisect_ = false;
+    unbreakable_pieces_.clear();
+    return;
+  }
+  unbreakable_pieces_.push_back(UnbreakablePiece{
+      logical_top_in_flow_thread, logical_bottom_in_flow_thread});
+}
+
+bool InitialColumnHeightFinder::UnbreakablePiecesFit(
+    LayoutUnit column_logical_height) const {
+  unsigned column_count = ColumnSet().UsedColumnCount();
+  unsigned used_columns = 1;
+  LayoutUnit column_logical_top = LogicalTopInFlowThread();
+  for (const UnbreakablePiece& piece : unbreakable_pieces_) {
+    if (piece.logical_bottom - column_logical_top <= column_logical_height ||
+        piece.logical_top <= column_logical_top)
+      continue;
+    // The piece crosses the column bottom, and gets pushed to the next column.
+    if (++used_columns > column_count)
+      return false;
+    column_logical_top = piece.logical_top;
+  }
+  // Any content after the last piece may be broken anywhere, so it just needs
+  // to fit in the remaining columns.
+  LayoutUnit remaining_space =
+      column_logical_height * (column_count - used_columns + 1);
+  return LogicalBottomInFlowThread() - column_logical_top <= remaining_space;
+}
+
+LayoutUnit InitialColumnHeightFinder::BisectedBalancedHeight(
+    LayoutUnit lower_bound) const {
+  if (UnbreakablePiecesFit(lower_bound))
+    return lower_bound;
+  // Everything fits in one column as tall as the flow thread portion.
+  LayoutUnit upper_bound =
+      LogicalBottomInFlowThread() - LogicalTopInFlowThread();
+  if (upper_bound <= lower_bound || !UnbreakablePiecesFit(upper_bound))
+    return lower_bound;
+  // The pieces don't fit at |low|, but they do at |high|. The number of
+  // columns used never grows with the column height, so we can bisect.
+  int low = lower_bound.RawValue();
+  int high = upper_bound.RawValue();
+  while (high - low > 1) {
+    int mid = low + (high - low) / 2;
+    if (UnbreakablePiecesFit(LayoutUnit::FromRawValue(mid)))
+      high = mid;
+    else
+      low = mid;
+  }
+  return LayoutUnit::FromRawValue(high);
+}
+
 LayoutUnit InitialColumnHeightFinder::SpaceUsedByStrutsAt(
     LayoutUnit offset_in_flow_thread) const {
   unsigned stop_before_column =
@@ -158,6 +158,32 @@ class InitialColumnHeightFinder final : public ColumnBalancer {
   // preceding the specified flowthread offset.
   LayoutUnit SpaceUsedByStrutsAt(LayoutUnit offset_in_flow_thread) const;
 
+  // Record a piece of content that we cannot break inside (a line, or a
+  // monolithic box), for BisectedBalancedHeight().
+  void RecordUnbreakablePiece(LayoutUnit logical_top_in_flow_thread,
+                              LayoutUnit logical_height);
+
+  // Return true if the recorded unbreakable pieces fit in used column-count
+  // columns of the specified height. The pieces are assumed to be pushed to
+  // the next column whenever they cross the bottom of a column, and the
+  // content between them may be broken anywhere.
+  bool UnbreakablePiecesFit(LayoutUnit column_logical_height) const;
+
+  // Bisect the lowest column height at which the unbreakable pieces fit,
+  // starting at |lower_bound|. The result is still a lower bound for the
+  // balanced height:
+  // - Wherever layout breaks the content into the columns, each piece is in
+  //   one column, so the pieces also fit in UnbreakablePiecesFit() at any
+  //   height at which the content fits. Orphans, widows, avoided breaks and
+  //   borders and padding pushed along with the pieces only move breaks up.
+  // - UnbreakablePiecesFit() pushes a piece only when it has to, which uses
+  //   the fewest columns for the pieces, and never more with taller columns.
+  // Since the column balancer stretches the columns only by the minimum space
+  // shortage after this, it ends up at the same balanced height as when
+  // starting at |lower_bound|. Compared to that, the result usually is the
+  // balanced height, which saves the layout passes to stretch the columns.
+  LayoutUnit BisectedBalancedHeight(LayoutUnit lower_bound) const;
+
   // Add a content run, specified by its end position. A content run is appended
   // at every forced/explicit break and at the end of the column set. The
   // content runs are used to determine where implicit/soft breaks will occur,
@@ -240,6 +266,17 @@ class InitialColumnHeightFinder final : public ColumnBalancer {
   // [1] http://www.w3.org/TR/css3-break/#parallel-flows
   Vector<LayoutUnit, 32> shortest_struts_;
 
+  // The lines and monolithic boxes in the flow thread portion, in flow order.
+  // Only recorded when we can bisect the column height, i.e. when there are
+  // no forced breaks, floats, parallel flows or struts.
+  struct UnbreakablePiece {
+    DISALLOW_NEW();
+    LayoutUnit logical_top;
+    LayoutUnit logical_bottom;
+  };
+  Vector<UnbreakablePiece> unbreakable_pieces_;
+  bool can_bisect_;
+
   LayoutUnit tallest_unbreakable_logical_height_;
   LayoutUnit last_break_seen_;
 };
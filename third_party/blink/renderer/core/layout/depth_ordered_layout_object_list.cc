@@ -9,6 +9,7 @@
 #include "third_party/blink/renderer/core/frame/local_frame_view.h"
 #include "third_party/blink/renderer/core/layout/layout_object.h"
 #include "third_party/blink/renderer/core/layout/ng/legacy_layout_tree_walking.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
 
 namespace blink {
 
@@ -52,6 +53,10 @@ bool DepthOrderedLayoutObjectList::IsEmpty() const {
 namespace {
 
 bool ListModificationAllowedFor(const LayoutObject& object) {
+  // Layout objects, and thus the layout roots, are only ever touched on the
+  // main thread.
+  if (!IsMainThread())
+    return false;
   if (!object.GetFrameView()->IsInPerformLayout())
     return true;
   // We are allowed to insert/remove orthogonal writing mode roots during
@@ -102,6 +107,7 @@ DepthOrderedLayoutObjectList::Unordered() const {
 
 const HeapVector<LayoutObjectWithDepth>&
 DepthOrderedLayoutObjectList::Ordered() {
+  DCHECK(IsMainThread());
   if (data_->objects_.IsEmpty() || !data_->ordered_objects_.IsEmpty())
     return data_->ordered_objects_;
 
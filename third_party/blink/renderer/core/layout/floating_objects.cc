@@ -35,6 +35,7 @@
 #include "third_party/blink/renderer/core/layout/layout_view.h"
 #include "third_party/blink/renderer/core/layout/shapes/shape_outside_info.h"
 #include "third_party/blink/renderer/core/paint/paint_layer.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/size_assertions.h"
 
 namespace blink {
@@ -488,6 +489,38 @@ void FloatingObjects::MarkLowestFloatLogicalBottomCacheAsDirty() {
     lowest_float_bottom_cache_[i].dirty = true;
 }
 
+void FloatingObjects::UpdateLowestFloatLogicalBottomCacheForAdd(
+    FloatingObject& floating_object) {
+  DCHECK(floating_object.IsPlaced());
+  int float_index = static_cast<int>(floating_object.GetType()) - 1;
+  FloatBottomCachedValue& cached_value =
+      lowest_float_bottom_cache_[float_index];
+  if (cached_value.dirty ||
+      cached_horizontal_writing_mode_ != horizontal_writing_mode_) {
+    cached_value.dirty = true;
+    return;
+  }
+  // Like LowestFloatLogicalBottom(), which only finds floats with a positive
+  // logical bottom.
+  LayoutUnit lowest_float_bottom =
+      cached_value.floating_object
+          ? layout_object_->LogicalBottomForFloat(*cached_value.floating_object)
+          : LayoutUnit();
+  if (layout_object_->LogicalBottomForFloat(floating_object) >
+      lowest_float_bottom) {
+    cached_value.floating_object = &floating_object;
+  }
+}
+
+void FloatingObjects::UpdateLowestFloatLogicalBottomCacheForRemove(
+    FloatingObject& floating_object) {
+  int float_index = static_cast<int>(floating_object.GetType()) - 1;
+  FloatBottomCachedValue& cached_value =
+      lowest_float_bottom_cache_[float_index];
+  if (cached_value.floating_object == &floating_object)
+    cached_value.dirty = true;
+}
+
 void FloatingObjects::MoveAllToFloatInfoMap(LayoutBoxToFloatInfoMap& map) {
   while (!set_.IsEmpty()) {
     FloatingObject* floating_object = set_.front();
@@ -534,7 +567,13 @@ void FloatingObjects::AddPlacedObject(FloatingObject& floating_object) {
 #if DCHECK_IS_ON()
   floating_object.SetIsInPlacedTree(true);
 #endif
-  MarkLowestFloatLogicalBottomCacheAsDirty();
+  if (RuntimeEnabledFeatures::IncrementalLowestFloatCacheEnabled())
+    UpdateLowestFloatLogicalBottomCacheForAdd(floating_object);
+  else
+    MarkLowestFloatLogicalBottomCacheAsDirty();
+#if EXPENSIVE_DCHECKS_ARE_ON()
+  CheckPlacedFloatsConsistency();
+#endif
 }
 
 void FloatingObjects::RemovePlacedObject(FloatingObject& floating_object) {
@@ -552,15 +591,23 @@ void FloatingObjects::RemovePlacedObject(FloatingObject& floating_object) {
 #if DCHECK_IS_ON()
   floating_object.SetIsInPlacedTree(false);
 #endif
-  MarkLowestFloatLogicalBottomCacheAsDirty();
+  if (RuntimeEnabledFeatures::IncrementalLowestFloatCacheEnabled())
+    UpdateLowestFloatLogicalBottomCacheForRemove(floating_object);
+  else
+    MarkLowestFloatLogicalBottomCacheAsDirty();
+#if EXPENSIVE_DCHECKS_ARE_ON()
+  CheckPlacedFloatsConsistency();
+#endif
 }
 
 FloatingObject* FloatingObjects::Add(FloatingObject* floating_object) {
   IncreaseObjectsCount(floating_object->GetType());
   set_.insert(floating_object);
+  // Only placed floats affect the lowest float, see AddPlacedObject().
   if (floating_object->IsPlaced())
     AddPlacedObject(*floating_object);
-  MarkLowestFloatLogicalBottomCacheAsDirty();
+  if (!RuntimeEnabledFeatures::IncrementalLowestFloatCacheEnabled())
+    MarkLowestFloatLogicalBottomCacheAsDirty();
   return floating_object;
 }
 
@@ -574,7 +621,8 @@ void FloatingObjects::Remove(FloatingObject* to_be_removed) {
   DCHECK(floating_object->IsPlaced() || !floating_object->IsInPlacedTree());
   if (floating_object->IsPlaced())
     RemovePlacedObject(*floating_object);
-  MarkLowestFloatLogicalBottomCacheAsDirty();
+  if (!RuntimeEnabledFeatures::IncrementalLowestFloatCacheEnabled())
+    MarkLowestFloatLogicalBottomCacheAsDirty();
   DCHECK(!floating_object->OriginatingLine());
 }
 
@@ -592,6 +640,42 @@ void FloatingObjects::ComputePlacedFloatsTree() {
   }
 }
 
+#if EXPENSIVE_DCHECKS_ARE_ON()
+void FloatingObjects::CheckPlacedFloatsConsistency() {
+  int placed_count = 0;
+  LayoutUnit lowest_float_bottom[2];
+  for (const auto& floating_object : set_) {
+    if (!floating_object->IsPlaced())
+      continue;
+    placed_count++;
+    if (placed_floats_tree_.IsInitialized()) {
+      DCHECK(placed_floats_tree_.Contains(
+          IntervalForFloatingObject(*floating_object)));
+    }
+    int float_index = static_cast<int>(floating_object->GetType()) - 1;
+    lowest_float_bottom[float_index] =
+        std::max(lowest_float_bottom[float_index],
+                 layout_object_->LogicalBottomForFloat(*floating_object));
+  }
+  if (placed_floats_tree_.IsInitialized()) {
+    DCHECK(placed_floats_tree_.CheckInvariants());
+    DCHECK_EQ(placed_count, placed_floats_tree_.size());
+  }
+  for (int i = 0; i < 2; i++) {
+    const FloatBottomCachedValue& cached_value = lowest_float_bottom_cache_[i];
+    if (cached_value.dirty ||
+        cached_horizontal_writing_mode_ != horizontal_writing_mode_) {
+      continue;
+    }
+    DCHECK_EQ(lowest_float_bottom[i],
+              cached_value.floating_object
+                  ? layout_object_->LogicalBottomForFloat(
+                        *cached_value.floating_object)
+                  : LayoutUnit());
+  }
+}
+#endif  // EXPENSIVE_DCHECKS_ARE_ON()
+
 LayoutUnit FloatingObjects::LogicalLeftOffsetForPositioningFloat(
     LayoutUnit fixed_offset,
     LayoutUnit logical_top,
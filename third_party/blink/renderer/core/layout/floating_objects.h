@@ -282,8 +282,17 @@ class FloatingObjects final : public GarbageCollected<FloatingObjects> {
                                          FloatingObject::Type float_type,
                                          FloatingObject*);
   void MarkLowestFloatLogicalBottomCacheAsDirty();
+  // Keeps the lowest float cache of the float's type valid when it is placed
+  // or removed, instead of going over all the floats on the next lookup.
+  void UpdateLowestFloatLogicalBottomCacheForAdd(FloatingObject&);
+  void UpdateLowestFloatLogicalBottomCacheForRemove(FloatingObject&);
 
   void ComputePlacedFloatsTree();
+#if EXPENSIVE_DCHECKS_ARE_ON()
+  // Checks that the placed floats tree and the lowest float cache agree with
+  // the placed floats in |set_|.
+  void CheckPlacedFloatsConsistency();
+#endif
   const FloatingObjectTree& PlacedFloatsTree() {
     if (!placed_floats_tree_.IsInitialized())
       ComputePlacedFloatsTree();
@@ -6,7 +6,9 @@
 #include "third_party/blink/renderer/core/layout/layout_grid.h"
 
 #include "base/memory/ptr_util.h"
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -361,6 +363,120 @@ TEST_F(GridTest, CellInsert) {
   EXPECT_EQ(cell3, result.node);
 }
 
+class GridTrackSizingContributionCacheTest : public GridTest,
+                                             private ScopedLayoutNGForTest {
+ public:
+  // The contribution cache is for the legacy grid only.
+  GridTrackSizingContributionCacheTest() : ScopedLayoutNGForTest(false) {}
+
+ protected:
+  struct TrackPositions {
+    Vector<LayoutUnit> columns;
+    Vector<LayoutUnit> rows;
+  };
+
+  TrackPositions Positions() {
+    auto* layout_grid = GetGridByElementId("grid");
+    return {layout_grid->ColumnPositions(), layout_grid->RowPositions()};
+  }
+
+  GridTrackSizingAlgorithm& Algorithm() {
+    return GetGridByElementId("grid")->TrackSizingAlgorithmForTesting();
+  }
+};
+
+TEST_F(GridTrackSizingContributionCacheTest, SameTrackSizes) {
+  const char* html = R"HTML(
+    <style>
+      #grid { display: grid; width: 300px; grid-template-columns: auto auto; }
+      .item { padding: 2px; }
+      .percent { height: 50%; }
+    </style>
+    <div id=grid>
+      <div class=item>aaa aaa aaa aaa aaa aaa</div>
+      <div class=item>bb bb</div>
+      <div class="item percent">c</div>
+      <div class=item style="grid-column: span 2">
+        ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd ddd
+      </div>
+      <div id=moving class=item>e e e e e e e e e e e e</div>
+    </div>
+  )HTML";
+
+  // Lays out the grid, and again after moving an item to a grid area of a
+  // different size, which gives the item different containing block sizes.
+  auto layout = [&](TrackPositions& initial, TrackPositions& moved) {
+    SetBodyInnerHTML(html);
+    initial = Positions();
+    GetElementById("moving")->setAttribute(html_names::kStyleAttr,
+                                           "grid-column: 1 / span 2");
+    UpdateAllLifecyclePhasesForTest();
+    moved = Positions();
+  };
+
+  TrackPositions initial;
+  TrackPositions moved;
+  {
+    ScopedGridTrackSizingContributionCacheForTest cache(false);
+    layout(initial, moved);
+    EXPECT_EQ(0u, Algorithm().LogicalHeightCacheHitsForTesting());
+    EXPECT_EQ(0u, Algorithm().LogicalHeightCacheMissesForTesting());
+  }
+
+  TrackPositions cached_initial;
+  TrackPositions cached_moved;
+  {
+    ScopedGridTrackSizingContributionCacheForTest cache(true);
+    layout(cached_initial, cached_moved);
+    // Each item is laid out at least once for its block size contributions,
+    // which are then reused by the other contributions of the row passes.
+    EXPECT_LT(0u, Algorithm().LogicalHeightCacheHitsForTesting());
+    EXPECT_LE(5u, Algorithm().LogicalHeightCacheMissesForTesting());
+  }
+
+  EXPECT_EQ(initial.columns, cached_initial.columns);
+  EXPECT_EQ(initial.rows, cached_initial.rows);
+  EXPECT_EQ(moved.columns, cached_moved.columns);
+  EXPECT_EQ(moved.rows, cached_moved.rows);
+}
+
+TEST_F(GridTrackSizingContributionCacheTest, KeyedByContainingBlockSizes) {
+  ScopedGridTrackSizingContributionCacheForTest cache(true);
+  SetBodyInnerHTML(R"HTML(
+    <div id=grid style="display: grid">
+      <div id=item>text</div>
+    </div>
+  )HTML");
+
+  GridTrackSizingAlgorithm& algorithm = Algorithm();
+  LayoutBox& item = *GetLayoutBoxByElementId("item");
+  // The cache is dropped at the end of the layout.
+  EXPECT_FALSE(algorithm.CachedLogicalHeightForChild(item));
+
+  item.SetOverrideContainingBlockContentLogicalWidth(LayoutUnit(100));
+  item.SetOverrideContainingBlockContentLogicalHeight(LayoutUnit(50));
+  algorithm.CacheLogicalHeightForChild(item, LayoutUnit(20));
+  EXPECT_EQ(LayoutUnit(20), algorithm.CachedLogicalHeightForChild(item));
+
+  // The grid area sizes are the containing block sizes of the item, and any
+  // change of them needs a new layout of the item.
+  item.SetOverrideContainingBlockContentLogicalWidth(LayoutUnit(200));
+  EXPECT_FALSE(algorithm.CachedLogicalHeightForChild(item));
+  algorithm.CacheLogicalHeightForChild(item, LayoutUnit(10));
+  EXPECT_EQ(LayoutUnit(10), algorithm.CachedLogicalHeightForChild(item));
+
+  // Both sizes are kept.
+  item.SetOverrideContainingBlockContentLogicalWidth(LayoutUnit(100));
+  EXPECT_EQ(LayoutUnit(20), algorithm.CachedLogicalHeightForChild(item));
+
+  item.SetOverrideContainingBlockContentLogicalHeight(LayoutUnit(60));
+  EXPECT_FALSE(algorithm.CachedLogicalHeightForChild(item));
+
+  // An indefinite containing block size is a different key too.
+  item.ClearOverrideContainingBlockContentSize();
+  EXPECT_FALSE(algorithm.CachedLogicalHeightForChild(item));
+}
+
 }  // anonymous namespace
 
 }  // namespace blink
@@ -9,6 +9,8 @@
 #include "third_party/blink/renderer/core/layout/grid_layout_utils.h"
 #include "third_party/blink/renderer/core/layout/layout_grid.h"
 #include "third_party/blink/renderer/platform/geometry/length_functions.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -363,12 +365,26 @@ LayoutUnit GridTrackSizingAlgorithmStrategy::LogicalHeightForChild(
     child.SetSelfNeedsLayoutForAvailableSpace(true);
   }
 
+  LayoutUnit baseline_offset = algorithm_->BaselineOffsetForChild(
+      child, GridAxisForDirection(Direction()));
+  if (absl::optional<LayoutUnit> cached_height =
+          algorithm_->CachedLogicalHeightForChild(child)) {
+    // The layout of the item is skipped. If its containing block sizes have
+    // changed since its last layout, it keeps its NeedsLayout bit, and is laid
+    // out for its final grid area by LayoutGrid::LayoutGridItems(). Until then
+    // its geometry may be stale, which is fine as long as the sizing
+    // algorithm doesn't read it. The only items whose geometry it reads are
+    // the baseline aligned and orthogonal ones, which are not cached.
+    return *cached_height + baseline_offset;
+  }
+
   child.LayoutIfNeeded();
 
-  return child.LogicalHeight() +
-         GridLayoutUtils::MarginLogicalHeightForChild(*GetLayoutGrid(), child) +
-         algorithm_->BaselineOffsetForChild(child,
-                                            GridAxisForDirection(Direction()));
+  LayoutUnit logical_height =
+      child.LogicalHeight() +
+      GridLayoutUtils::MarginLogicalHeightForChild(*GetLayoutGrid(), child);
+  algorithm_->CacheLogicalHeightForChild(child, logical_height);
+  return logical_height + baseline_offset;
 }
 
 DISABLE_CFI_PERF
@@ -546,6 +562,67 @@ LayoutUnit GridTrackSizingAlgorithm::BaselineOffsetForChild(
                                                     child, baseline_axis);
 }
 
+namespace {
+
+absl::optional<LayoutUnit> OverrideContainingBlockSizeForCache(
+    const LayoutBox& child,
+    GridTrackSizingDirection direction) {
+  if (!GridLayoutUtils::HasOverrideContainingBlockContentSizeForChild(
+          child, direction)) {
+    return absl::nullopt;
+  }
+  return GridLayoutUtils::OverrideContainingBlockContentSizeForChild(child,
+                                                                     direction);
+}
+
+}  // namespace
+
+bool GridTrackSizingAlgorithm::CanCacheLogicalHeightForChild(
+    const LayoutBox& child) const {
+  // The baseline alignment context reads the layout of the items which take
+  // part in it, and the inline size contributions of orthogonal items are read
+  // from their layout, so they have to be laid out for their current sizes.
+  return RuntimeEnabledFeatures::GridTrackSizingContributionCacheEnabled() &&
+         !column_baseline_items_map_.Contains(&child) &&
+         !row_baseline_items_map_.Contains(&child) &&
+         !GridLayoutUtils::IsOrthogonalChild(*layout_grid_, child);
+}
+
+absl::optional<LayoutUnit>
+GridTrackSizingAlgorithm::CachedLogicalHeightForChild(const LayoutBox& child) {
+  if (!CanCacheLogicalHeightForChild(child))
+    return absl::nullopt;
+  auto it = logical_height_cache_.find(&child);
+  if (it != logical_height_cache_.end()) {
+    absl::optional<LayoutUnit> width =
+        OverrideContainingBlockSizeForCache(child, kForColumns);
+    absl::optional<LayoutUnit> height =
+        OverrideContainingBlockSizeForCache(child, kForRows);
+    for (const CachedLogicalHeight& entry : it->value) {
+      if (entry.containing_block_width == width &&
+          entry.containing_block_height == height) {
+        logical_height_cache_hits_++;
+        return entry.logical_height;
+      }
+    }
+  }
+  logical_height_cache_misses_++;
+  return absl::nullopt;
+}
+
+void GridTrackSizingAlgorithm::CacheLogicalHeightForChild(
+    const LayoutBox& child,
+    LayoutUnit logical_height) {
+  if (!CanCacheLogicalHeightForChild(child))
+    return;
+  auto& entries =
+      logical_height_cache_.insert(&child, Vector<CachedLogicalHeight, 1>())
+          .stored_value->value;
+  entries.push_back(CachedLogicalHeight{
+      OverrideContainingBlockSizeForCache(child, kForColumns),
+      OverrideContainingBlockSizeForCache(child, kForRows), logical_height});
+}
+
 void GridTrackSizingAlgorithm::ClearBaselineItemsCache() {
   column_baseline_items_map_.clear();
   row_baseline_items_map_.clear();
@@ -1825,6 +1902,19 @@ void GridTrackSizingAlgorithm::Reset() {
   has_percent_sized_rows_indefinite_height_ = false;
   SetAvailableSpace(kForRows, absl::nullopt);
   SetAvailableSpace(kForColumns, absl::nullopt);
+
+  if (logical_height_cache_hits_ || logical_height_cache_misses_) {
+    TRACE_EVENT_INSTANT2("blink", "GridTrackSizingAlgorithm::Reset",
+                         TRACE_EVENT_SCOPE_THREAD, "logical_height_cache_hits",
+                         logical_height_cache_hits_,
+                         "logical_height_cache_misses",
+                         logical_height_cache_misses_);
+  }
+  logical_height_cache_.clear();
+  last_logical_height_cache_hits_ = logical_height_cache_hits_;
+  last_logical_height_cache_misses_ = logical_height_cache_misses_;
+  logical_height_cache_hits_ = 0;
+  logical_height_cache_misses_ = 0;
 }
 
 #if DCHECK_IS_ON()
@@ -120,6 +120,20 @@ class GridTrackSizingAlgorithm final
 
   LayoutSize EstimatedGridAreaBreadthForChild(const LayoutBox& child) const;
 
+  // The logical heights plus margins of grid items which the strategies lay
+  // out to get their block size contributions, by the containing block sizes
+  // the items were laid out with. They are kept until Reset(), as the items
+  // don't change during the sizing passes of a layout.
+  absl::optional<LayoutUnit> CachedLogicalHeightForChild(const LayoutBox&);
+  void CacheLogicalHeightForChild(const LayoutBox&, LayoutUnit);
+  // The number of hits and misses of the above in the last layout.
+  unsigned LogicalHeightCacheHitsForTesting() const {
+    return last_logical_height_cache_hits_;
+  }
+  unsigned LogicalHeightCacheMissesForTesting() const {
+    return last_logical_height_cache_misses_;
+  }
+
   Vector<GridTrack>& Tracks(GridTrackSizingDirection);
   const Vector<GridTrack>& Tracks(GridTrackSizingDirection) const;
 
@@ -146,6 +160,7 @@ class GridTrackSizingAlgorithm final
     visitor->Trace(baseline_alignment_);
     visitor->Trace(column_baseline_items_map_);
     visitor->Trace(row_baseline_items_map_);
+    visitor->Trace(logical_height_cache_);
   }
 
  private:
@@ -270,6 +285,19 @@ class GridTrackSizingAlgorithm final
   BaselineItemsCache column_baseline_items_map_;
   BaselineItemsCache row_baseline_items_map_;
 
+  struct CachedLogicalHeight {
+    absl::optional<LayoutUnit> containing_block_width;
+    absl::optional<LayoutUnit> containing_block_height;
+    LayoutUnit logical_height;
+  };
+  bool CanCacheLogicalHeightForChild(const LayoutBox&) const;
+  HeapHashMap<Member<const LayoutBox>, Vector<CachedLogicalHeight, 1>>
+      logical_height_cache_;
+  unsigned logical_height_cache_hits_ = 0;
+  unsigned logical_height_cache_misses_ = 0;
+  unsigned last_logical_height_cache_hits_ = 0;
+  unsigned last_logical_height_cache_misses_ = 0;
+
   // This is a RAII class used to ensure that the track sizing algorithm is
   // executed as it is suppossed to be, i.e., first resolve columns and then
   // rows. Only if required a second iteration is run following the same order,
@@ -260,8 +260,11 @@ void LayoutBlock::StyleDidChange(StyleDifference diff,
     }
   }
 
-  if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer())
+  if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer()) {
     text_autosizer->Record(this);
+    if (old_style)
+      text_autosizer->BlockStyleChanged(this, *old_style);
+  }
 
   PropagateStyleToAnonymousChildren();
 
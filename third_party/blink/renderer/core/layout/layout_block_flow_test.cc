@@ -2,12 +2,23 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "third_party/blink/renderer/core/layout/layout_block_flow.h"
+
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/layout/ng/ng_layout_test.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
 class LayoutBlockFlowTest : public NGLayoutTest {};
 
+class LayoutBlockFlowLegacyTest : public RenderingTest,
+                                  private ScopedLayoutNGForTest {
+ public:
+  // FloatingObjects are for legacy layout only.
+  LayoutBlockFlowLegacyTest() : ScopedLayoutNGForTest(false) {}
+};
+
 // crbug.com/1253159.  We had a bug that a legacy IFC LayoutBlockFlow didn't
 // call RecalcVisualOverflow() for children.
 TEST_F(LayoutBlockFlowTest, RecalcInlineChildrenLayoutOverflow) {
@@ -31,4 +42,46 @@ var { column-count: 17179869184; }
   // The test passes if no DCHECK failure in ng_ink_overflow.cc.
 }
 
+TEST_F(LayoutBlockFlowLegacyTest, LowestFloatLogicalBottom) {
+  ScopedIncrementalLowestFloatCacheForTest incremental_cache(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      .left { float: left; width: 10px; }
+      .right { float: right; width: 10px; }
+    </style>
+    <div id="container">
+      <div class="left" style="height: 50px"></div>
+      <div class="right" style="height: 80px"></div>
+    </div>
+  )HTML");
+  auto* container =
+      To<LayoutBlockFlow>(GetLayoutObjectByElementId("container"));
+  EXPECT_EQ(LayoutUnit(50), container->LowestFloatLogicalBottom(EClear::kLeft));
+  EXPECT_EQ(LayoutUnit(80),
+            container->LowestFloatLogicalBottom(EClear::kRight));
+  EXPECT_EQ(LayoutUnit(80), container->LowestFloatLogicalBottom());
+
+  // Floats placed after the lowest floats were cached.
+  Element* left = GetDocument().CreateRawElement(html_names::kDivTag);
+  left->setAttribute(html_names::kClassAttr, "left");
+  left->setAttribute(html_names::kStyleAttr, "height: 120px");
+  GetElementById("container")->AppendChild(left);
+  Element* right = GetDocument().CreateRawElement(html_names::kDivTag);
+  right->setAttribute(html_names::kClassAttr, "right");
+  right->setAttribute(html_names::kStyleAttr, "height: 20px");
+  GetElementById("container")->AppendChild(right);
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(LayoutUnit(120),
+            container->LowestFloatLogicalBottom(EClear::kLeft));
+  EXPECT_EQ(LayoutUnit(80),
+            container->LowestFloatLogicalBottom(EClear::kRight));
+  EXPECT_EQ(LayoutUnit(120), container->LowestFloatLogicalBottom());
+
+  // Removal of the lowest float.
+  left->remove();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(LayoutUnit(50), container->LowestFloatLogicalBottom(EClear::kLeft));
+  EXPECT_EQ(LayoutUnit(80), container->LowestFloatLogicalBottom());
+}
+
 }  // namespace blink
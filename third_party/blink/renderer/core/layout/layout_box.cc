@@ -141,7 +141,6 @@ struct SameSizeAsLayoutBox : public LayoutBoxModelObject {
   Member<void*> result;
   HeapVector<Member<const NGLayoutResult>, 1> layout_results;
   void* pointers[2];
-  Member<void*> inline_box_wrapper;
   wtf_size_t first_fragment_item_index_;
   Member<void*> rare_data;
 };
@@ -461,13 +460,13 @@ void LayoutBoxRareData::Trace(Visitor* visitor) const {
   visitor->Trace(snap_container_);
   visitor->Trace(snap_areas_);
   visitor->Trace(layout_child_);
+  visitor->Trace(inline_box_wrapper_);
 }
 
 LayoutBox::LayoutBox(ContainerNode* node)
     : LayoutBoxModelObject(node),
       intrinsic_content_logical_height_(-1),
-      intrinsic_logical_widths_initial_block_size_(LayoutUnit::Min()),
-      inline_box_wrapper_(nullptr) {
+      intrinsic_logical_widths_initial_block_size_(LayoutUnit::Min()) {
   SetIsBox();
   if (blink::IsA<HTMLLegendElement>(node))
     SetIsHTMLLegendElement();
@@ -476,7 +475,6 @@ LayoutBox::LayoutBox(ContainerNode* node)
 void LayoutBox::Trace(Visitor* visitor) const {
   visitor->Trace(measure_result_);
   visitor->Trace(layout_results_);
-  visitor->Trace(inline_box_wrapper_);
   visitor->Trace(rare_data_);
   LayoutBoxModelObject::Trace(visitor);
 }
@@ -3197,12 +3195,12 @@ InlineBox* LayoutBox::CreateInlineBox() {
 
 void LayoutBox::DirtyLineBoxes(bool full_layout) {
   NOT_DESTROYED();
-  if (!IsInLayoutNGInlineFormattingContext() && inline_box_wrapper_) {
+  if (InlineBox* inline_box_wrapper = InlineBoxWrapper()) {
     if (full_layout) {
-      inline_box_wrapper_->Destroy();
-      inline_box_wrapper_ = nullptr;
+      inline_box_wrapper->Destroy();
+      rare_data_->inline_box_wrapper_ = nullptr;
     } else {
-      inline_box_wrapper_->DirtyLineBoxes();
+      inline_box_wrapper->DirtyLineBoxes();
     }
   }
 }
@@ -3210,7 +3208,7 @@ void LayoutBox::DirtyLineBoxes(bool full_layout) {
 bool LayoutBox::HasInlineFragments() const {
   NOT_DESTROYED();
   if (!IsInLayoutNGInlineFormattingContext())
-    return inline_box_wrapper_;
+    return InlineBoxWrapper();
   return first_fragment_item_index_;
 }
 
@@ -3234,9 +3232,11 @@ void LayoutBox::InLayoutNGInlineFormattingContextWillChange(bool new_value) {
   else
     DeleteLineBoxWrapper();
 
-  // Because |first_fragment_item_index_| and |inline_box_wrapper_| are union,
-  // when one is deleted, the other should be initialized to nullptr.
-  DCHECK(new_value ? !first_fragment_item_index_ : !inline_box_wrapper_);
+  // Because |first_fragment_item_index_| and the inline box wrapper are used
+  // exclusively, when one is deleted, the other should be initialized to
+  // nullptr.
+  DCHECK(new_value ? !first_fragment_item_index_
+                   : !rare_data_ || !rare_data_->inline_box_wrapper_);
 }
 
 bool LayoutBox::NGPhysicalFragmentList::HasFragmentItems() const {
@@ -3563,11 +3563,11 @@ void LayoutBox::MoveWithEdgeOfInlineContainerIfNecessary(bool is_horizontal) {
 
 void LayoutBox::DeleteLineBoxWrapper() {
   NOT_DESTROYED();
-  if (!IsInLayoutNGInlineFormattingContext() && inline_box_wrapper_) {
+  if (InlineBox* inline_box_wrapper = InlineBoxWrapper()) {
     if (!DocumentBeingDestroyed())
-      inline_box_wrapper_->Remove();
-    inline_box_wrapper_->Destroy();
-    inline_box_wrapper_ = nullptr;
+      inline_box_wrapper->Remove();
+    inline_box_wrapper->Destroy();
+    rare_data_->inline_box_wrapper_ = nullptr;
   }
 }
 
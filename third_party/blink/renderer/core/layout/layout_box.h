@@ -129,6 +129,11 @@ struct LayoutBoxRareData final : public GarbageCollected<LayoutBoxRareData> {
   // object for this box that web developers can query style, and perform
   // layout upon. Only created if IsCustomItem() is true.
   Member<CustomLayoutChild> layout_child_;
+
+  // The inline box containing this LayoutBox, for atomic inline elements.
+  // Valid only when !IsInLayoutNGInlineFormattingContext(), so it is kept
+  // here rather than in LayoutBox, whose boxes are mostly laid out by NG.
+  Member<InlineBox> inline_box_wrapper_;
 };
 
 // LayoutBox implements the full CSS box model.
@@ -1833,6 +1838,13 @@ class CORE_EXPORT LayoutBox : public LayoutBoxModelObject {
     return LayoutOverflowIsSet();
   }
 
+  // Whether the LayoutBoxRareData with the rarely used fields of this box has
+  // been allocated.
+  bool HasRareData() const {
+    NOT_DESTROYED();
+    return rare_data_;
+  }
+
   // Return true if re-laying out the containing block of this object means that
   // we need to recalculate the preferred min/max logical widths of this object.
   //
@@ -2455,10 +2467,6 @@ class CORE_EXPORT LayoutBox : public LayoutBoxModelObject {
   // laid out.
   const BoxLayoutExtraInput* extra_input_ = nullptr;
 
-  // The inline box containing this LayoutBox, for atomic inline elements.
-  // Valid only when !IsInLayoutNGInlineFormattingContext().
-  Member<InlineBox> inline_box_wrapper_;
-
   // The index of the first fragment item associated with this object in
   // |NGFragmentItems::Items()|. Zero means there are no such item.
   // Valid only when IsInLayoutNGInlineFormattingContext().
@@ -2527,24 +2535,30 @@ inline LayoutBox* LayoutBox::NextSiblingMultiColumnBox() const {
 }
 
 inline InlineBox* LayoutBox::InlineBoxWrapper() const {
-  return IsInLayoutNGInlineFormattingContext() ? nullptr : inline_box_wrapper_;
+  if (IsInLayoutNGInlineFormattingContext() || !rare_data_)
+    return nullptr;
+  return rare_data_->inline_box_wrapper_;
 }
 
 inline void LayoutBox::SetInlineBoxWrapper(InlineBox* box_wrapper) {
   CHECK(!IsInLayoutNGInlineFormattingContext());
 
-  if (box_wrapper) {
-    DCHECK(!inline_box_wrapper_);
-    // inline_box_wrapper_ should already be nullptr. Deleting it is a safeguard
-    // against security issues. Otherwise, there will two line box wrappers
-    // keeping the reference to this layoutObject, and only one will be notified
-    // when the layoutObject is getting destroyed. The second line box wrapper
-    // will keep a stale reference.
-    if (UNLIKELY(inline_box_wrapper_ != nullptr))
-      DeleteLineBoxWrapper();
+  if (!box_wrapper) {
+    if (rare_data_)
+      rare_data_->inline_box_wrapper_ = nullptr;
+    return;
   }
 
-  inline_box_wrapper_ = box_wrapper;
+  DCHECK(!InlineBoxWrapper());
+  // The inline box wrapper should already be nullptr. Deleting it is a
+  // safeguard against security issues. Otherwise, there will two line box
+  // wrappers keeping the reference to this layoutObject, and only one will be
+  // notified when the layoutObject is getting destroyed. The second line box
+  // wrapper will keep a stale reference.
+  if (UNLIKELY(InlineBoxWrapper() != nullptr))
+    DeleteLineBoxWrapper();
+
+  EnsureRareData().inline_box_wrapper_ = box_wrapper;
 }
 
 inline wtf_size_t LayoutBox::FirstInlineFragmentItemIndex() const {
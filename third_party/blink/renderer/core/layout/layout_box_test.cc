@@ -488,6 +488,25 @@ TEST_P(LayoutBoxTest, ControlClip) {
   EXPECT_EQ(PhysicalRect(2, 2, 96, 46), target->ClippingRect(PhysicalOffset()));
 }
 
+TEST_P(LayoutBoxTest, InlineBoxWrapperInRareData) {
+  SetBodyInnerHTML(R"HTML(
+    <div>text <span id='atomic' style='display: inline-block'>box</span></div>
+    <div id='block'>block</div>
+  )HTML");
+  const LayoutBox* atomic = GetLayoutBoxByElementId("atomic");
+  const LayoutBox* block = GetLayoutBoxByElementId("block");
+  EXPECT_FALSE(block->HasRareData());
+  // Only legacy inline layout creates an inline box wrapper, which is kept in
+  // the rare data.
+  if (atomic->IsInLayoutNGInlineFormattingContext()) {
+    EXPECT_FALSE(atomic->InlineBoxWrapper());
+    EXPECT_FALSE(atomic->HasRareData());
+  } else {
+    EXPECT_TRUE(atomic->InlineBoxWrapper());
+    EXPECT_TRUE(atomic->HasRareData());
+  }
+}
+
 TEST_P(LayoutBoxTest, VisualOverflowRectWithBlockChild) {
   SetBodyInnerHTML(R"HTML(
     <div id='target' style='width: 100px; height: 100px; baground: blue'>
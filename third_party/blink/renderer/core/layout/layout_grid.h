@@ -146,6 +146,10 @@ class LayoutGrid final : public LayoutBlock, public LayoutNGGridInterface {
     NOT_DESTROYED();
     return grid_;
   }
+  GridTrackSizingAlgorithm& TrackSizingAlgorithmForTesting() const {
+    NOT_DESTROYED();
+    return *track_sizing_algorithm_;
+  }
 
  protected:
   ItemPosition SelfAlignmentNormalBehavior(
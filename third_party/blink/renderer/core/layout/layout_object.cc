@@ -89,6 +89,7 @@
 #include "third_party/blink/renderer/core/layout/layout_object_inlines.h"
 #include "third_party/blink/renderer/core/layout/layout_ruby_run.h"
 #include "third_party/blink/renderer/core/layout/layout_table_caption.h"
+#include "third_party/blink/renderer/core/layout/layout_table_cell.h"
 #include "third_party/blink/renderer/core/layout/layout_text_fragment.h"
 #include "third_party/blink/renderer/core/layout/layout_theme.h"
 #include "third_party/blink/renderer/core/layout/layout_view.h"
@@ -102,6 +103,8 @@
 #include "third_party/blink/renderer/core/layout/ng/ng_unpositioned_float.h"
 #include "third_party/blink/renderer/core/layout/ng/table/layout_ng_table.h"
 #include "third_party/blink/renderer/core/layout/ng/table/layout_ng_table_cell.h"
+#include "third_party/blink/renderer/core/layout/text_autosizer.h"
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
 #include "third_party/blink/renderer/core/page/autoscroll_controller.h"
 #include "third_party/blink/renderer/core/page/page.h"
 #include "third_party/blink/renderer/core/paint/fragment_data_iterator.h"
@@ -1530,6 +1533,9 @@ void LayoutObject::SetIntrinsicLogicalWidthsDirty(
   bitfields_.SetIntrinsicLogicalWidthsDirty(true);
   bitfields_.SetIntrinsicLogicalWidthsDependsOnBlockConstraints(true);
   bitfields_.SetIntrinsicLogicalWidthsChildDependsOnBlockConstraints(true);
+  if (RuntimeEnabledFeatures::IncrementalTableColumnRecalcEnabled() &&
+      IsTableCellLegacy())
+    To<LayoutTableCell>(this)->IntrinsicLogicalWidthsChanged();
   if (mark_parents == kMarkContainerChain &&
       (IsText() || !StyleRef().HasOutOfFlowPosition()))
     InvalidateContainerIntrinsicLogicalWidths();
@@ -1611,6 +1617,9 @@ inline void LayoutObject::InvalidateContainerIntrinsicLogicalWidths() {
       break;
 
     o->bitfields_.SetIntrinsicLogicalWidthsDirty(true);
+    if (RuntimeEnabledFeatures::IncrementalTableColumnRecalcEnabled() &&
+        o->IsTableCellLegacy())
+      To<LayoutTableCell>(o)->IntrinsicLogicalWidthsChanged();
     // A positioned object has no effect on the min/max width of its containing
     // block ever. We can optimize this case and not go up any further.
     if (o->StyleRef().HasOutOfFlowPosition())
@@ -2063,6 +2072,22 @@ bool LayoutObject::MapToVisualRectInAncestorSpaceInternalFastPath(
   if (ancestor == this)
     return true;
 
+  // The result only depends on the paint offsets and the paint properties of
+  // this object and the ancestor, which are not changed without clearing the
+  // cache of the frame once the lifecycle is past pre-paint. Mappings to an
+  // ancestor in another frame also depend on the properties of the frames in
+  // between, so they are not cached.
+  VisualRectMappingCache* cache = nullptr;
+  if (RuntimeEnabledFeatures::CachedVisualRectMappingEnabled() &&
+      GetDocument().Lifecycle().GetState() >=
+          DocumentLifecycle::kPrePaintClean &&
+      ancestor->GetFrameView() == GetFrameView()) {
+    cache = &GetFrameView()->GetVisualRectMappingCache();
+    if (cache->Find(*this, *ancestor, visual_rect_flags, rect, intersects))
+      return true;
+  }
+  const PhysicalRect input_rect = rect;
+
   AncestorSkipInfo skip_info(ancestor);
   PropertyTreeState container_properties = PropertyTreeState::Uninitialized();
   const LayoutObject* property_container =
@@ -2087,6 +2112,10 @@ bool LayoutObject::MapToVisualRectInAncestorSpaceInternalFastPath(
   }
   rect.offset -= ancestor->FirstFragment().PaintOffset();
 
+  if (cache) {
+    cache->Add(*this, *ancestor, visual_rect_flags, input_rect, rect,
+               intersects);
+  }
   return true;
 }
 
@@ -3602,6 +3631,10 @@ inline void LayoutObject::ClearLayoutRootIfNeeded() const {
 
 void LayoutObject::WillBeDestroyed() {
   NOT_DESTROYED();
+  // Don't keep this object alive in the cached mappings of the frame.
+  if (LocalFrameView* frame_view = GetFrameView())
+    frame_view->GetVisualRectMappingCache().Remove(*this);
+
   // Destroy any leftover anonymous children.
   LayoutObjectChildList* children = VirtualChildren();
   if (children)
@@ -3698,6 +3731,11 @@ void LayoutObject::InsertedIntoTree() {
 
   if (LayoutFlowThread* flow_thread = FlowThreadContainingBlock())
     flow_thread->FlowThreadDescendantWasInserted(this);
+
+  if (RuntimeEnabledFeatures::IncrementalTextAutosizerClustersEnabled()) {
+    if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer())
+      text_autosizer->InsertedIntoTree(this);
+  }
 }
 
 enum FindReferencingScrollAnchorsBehavior { kDontClear, kClear };
@@ -3756,6 +3794,11 @@ void LayoutObject::WillBeRemovedFromTree() {
 
   RemoveFromLayoutFlowThread();
 
+  if (RuntimeEnabledFeatures::IncrementalTextAutosizerClustersEnabled()) {
+    if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer())
+      text_autosizer->WillBeRemovedFromTree(this);
+  }
+
   // Update cached boundaries in SVG layoutObjects if a child is removed.
   if (Parent()->IsSVG())
     Parent()->SetNeedsBoundariesUpdate();
@@ -0,0 +1,501 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Benchmarks for the layout of large documents which are updated every frame.
+// Most of them run once with and once without the runtime feature which
+// optimizes the measured code path.
+
+#include "base/timer/elapsed_timer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/dom/text.h"
+#include "third_party/blink/renderer/core/frame/local_frame_view.h"
+#include "third_party/blink/renderer/core/frame/settings.h"
+#include "third_party/blink/renderer/core/html/html_body_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/layout/layout_shift_region.h"
+#include "third_party/blink/renderer/core/loader/empty_clients.h"
+#include "third_party/blink/renderer/core/testing/dummy_page_holder.h"
+#include "third_party/blink/renderer/core/testing/no_network_web_url_loader.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+std::unique_ptr<DummyPageHolder> CreatePage() {
+  return std::make_unique<DummyPageHolder>(
+      gfx::Size(800, 600), nullptr,
+      MakeGarbageCollected<NoNetworkLocalFrameClient>());
+}
+
+String TableRows(int first_row, int num_rows, int num_columns) {
+  StringBuilder html;
+  for (int i = first_row; i < first_row + num_rows; ++i) {
+    html.Append("<tr>");
+    for (int j = 0; j < num_columns; ++j) {
+      html.Append("<td>");
+      html.AppendNumber(i * num_columns + j);
+      html.Append("</td>");
+    }
+    html.Append("</tr>");
+  }
+  return html.ToString();
+}
+
+String DenseGrid(int num_items) {
+  StringBuilder html;
+  html.Append(
+      "<style>"
+      "  #grid { display: grid; grid-template-columns: repeat(10, auto); }"
+      "  .percent { height: 50%; }"
+      "</style>"
+      "<div id=grid>");
+  for (int i = 0; i < num_items; ++i) {
+    // Some of the items have a relative block size, which makes the track
+    // sizing algorithm lay them out again for each of their contributions.
+    html.Append(i % 3 ? "<div>" : "<div class=percent>");
+    html.Append("Lorem ipsum dolor sit amet</div>");
+  }
+  html.Append("</div>");
+  return html.ToString();
+}
+
+String ParagraphsWithFloats(int num_paragraphs) {
+  StringBuilder html;
+  for (int i = 0; i < num_paragraphs; ++i) {
+    html.Append(i % 2 ? "<p><span class=left></span>"
+                      : "<p><span class=right></span>");
+    html.Append("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed "
+                "do eiusmod tempor incididunt ut labore et dolore.</p>");
+  }
+  return html.ToString();
+}
+
+String MulticolArticle(int num_paragraphs) {
+  StringBuilder html;
+  html.Append("<article id=article style='column-count: 3'>");
+  for (int i = 0; i < num_paragraphs; ++i) {
+    if (i % 20 == 0)
+      html.Append("<img style='display: block; height: 120px'>");
+    html.Append("<p>");
+    // Vary the paragraph lengths, so that the balanced column height is not
+    // just the height of the article divided by three.
+    for (int j = 0; j <= i % 7; ++j) {
+      html.Append(
+          "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+          "eiusmod tempor incididunt ut labore et dolore magna aliqua. ");
+    }
+    html.Append("</p>");
+  }
+  html.Append("</article>");
+  return html.ToString();
+}
+
+String Dashboard(int num_widgets, int items_per_widget) {
+  StringBuilder html;
+  html.Append(
+      "<style>"
+      "  .widget { contain: strict; display: inline-block; width: 150px;"
+      "            height: 100px; overflow: auto; }"
+      "</style>");
+  for (int i = 0; i < num_widgets; ++i) {
+    html.Append("<div class=widget>");
+    for (int j = 0; j < items_per_widget; ++j)
+      html.Append("<div>item</div>");
+    html.Append("</div>");
+  }
+  return html.ToString();
+}
+
+String Comments(int num_comments) {
+  StringBuilder html;
+  for (int i = 0; i < num_comments; ++i)
+    html.Append("<div class=comment>Nice article, thanks!</div>");
+  return html.ToString();
+}
+
+String ArticleWithComments(int num_paragraphs, int num_comments) {
+  StringBuilder html;
+  html.Append(
+      "<style>"
+      "  .comment { width: 400px; }"
+      "</style>"
+      "<article>");
+  for (int i = 0; i < num_paragraphs; ++i) {
+    html.Append(
+        "<p>Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+        "eiusmod tempor incididunt ut labore et dolore magna aliqua.</p>");
+  }
+  html.Append("</article><section id=comments>");
+  html.Append(Comments(num_comments));
+  html.Append("</section>");
+  return html.ToString();
+}
+
+}  // namespace
+
+// Appends rows to a huge auto layout table, like an infinite scrolling data
+// grid, with and without the incremental column recalc of
+// TableLayoutAlgorithmAuto.
+static void MeasureAppendTableRows(bool incremental, const char* label) {
+  // TablesNG does not use TableLayoutAlgorithmAuto.
+  ScopedLayoutNGForTest layout_ng(false);
+  ScopedIncrementalTableColumnRecalcForTest incremental_recalc(incremental);
+
+  constexpr int kNumColumns = 8;
+  constexpr int kNumRows = 10000;
+  constexpr int kRowsPerAppend = 100;
+  constexpr int kNumAppends = 50;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  document.body()->setInnerHTML("<table><tbody id=body>" +
+                                    TableRows(0, kNumRows, kNumColumns) +
+                                    "</tbody></table>",
+                                ASSERT_NO_EXCEPTION);
+  Persistent<Element> body = document.getElementById("body");
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumAppends; ++i) {
+    body->insertAdjacentHTML(
+        "beforeend",
+        TableRows(kNumRows + i * kRowsPerAppend, kRowsPerAppend, kNumColumns),
+        ASSERT_NO_EXCEPTION);
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("AppendTime", "us");
+  reporter.AddResult("AppendTime", timer.Elapsed());
+}
+
+TEST(LayoutPerfTest, AppendTableRows) {
+  MeasureAppendTableRows(/*incremental=*/false, "AppendTableRows");
+}
+
+TEST(LayoutPerfTest, AppendTableRowsIncremental) {
+  MeasureAppendTableRows(/*incremental=*/true, "AppendTableRowsIncremental");
+}
+
+// The per-frame LayoutShiftRegion bookkeeping of LayoutShiftTracker when the
+// items of a growing list shift down together, with and without coalescing
+// the rects of the region.
+static void MeasureShiftedList(bool coalesce, const char* label) {
+  ScopedCoalescedLayoutShiftRegionForTest coalesced(coalesce);
+
+  constexpr int kNumFrames = 20;
+  constexpr int kItemCounts[] = {1000, 10000, 100000};
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  LayoutShiftRegion region;
+  for (int num_items : kItemCounts) {
+    uint64_t checksum = 0;
+    base::ElapsedTimer timer;
+    for (int frame = 0; frame < kNumFrames; ++frame) {
+      // Like LayoutShiftTracker::ObjectShifted(), which adds the old and the
+      // new visual rect of each shifted box.
+      for (int i = 0; i < num_items; ++i) {
+        region.AddRect(gfx::Rect(8, i * 20 + frame, 400, 20));
+        region.AddRect(gfx::Rect(8, i * 20 + frame + 1, 400, 20));
+      }
+      checksum += region.Area();
+      region.Reset();
+    }
+    CHECK(checksum);
+
+    StringBuilder metric;
+    metric.Append("FrameTime");
+    metric.AppendNumber(num_items);
+    reporter.RegisterImportantMetric(metric.ToString().Utf8(), "us");
+    reporter.AddResult(metric.ToString().Utf8(), timer.Elapsed() / kNumFrames);
+  }
+}
+
+TEST(LayoutPerfTest, ShiftedList) {
+  MeasureShiftedList(/*coalesce=*/false, "ShiftedList");
+}
+
+TEST(LayoutPerfTest, ShiftedListCoalesced) {
+  MeasureShiftedList(/*coalesce=*/true, "ShiftedListCoalesced");
+}
+
+// Lays out a dense grid with auto-sized tracks, like a data table built with
+// CSS grid, with and without reusing the block size contributions of the grid
+// items across the sizing passes of a layout.
+static void MeasureResizeDenseGrid(bool cache, const char* label) {
+  // Only the legacy grid uses GridTrackSizingAlgorithm.
+  ScopedLayoutNGForTest layout_ng(false);
+  ScopedGridTrackSizingContributionCacheForTest contribution_cache(cache);
+
+  constexpr int kNumItems = 2000;
+  constexpr int kNumResizes = 20;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  document.body()->setInnerHTML(DenseGrid(kNumItems), ASSERT_NO_EXCEPTION);
+  Persistent<Element> grid = document.getElementById("grid");
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumResizes; ++i) {
+    // A new width of the grid resizes the columns, so all of the items are
+    // laid out again for their block size contributions.
+    grid->setAttribute(html_names::kStyleAttr,
+                       "width: " + String::Number(600 + (i % 2) * 100) + "px");
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("ResizeTime", "us");
+  reporter.AddResult("ResizeTime", timer.Elapsed());
+}
+
+TEST(LayoutPerfTest, ResizeDenseGrid) {
+  MeasureResizeDenseGrid(/*cache=*/false, "ResizeDenseGrid");
+}
+
+TEST(LayoutPerfTest, ResizeDenseGridWithContributionCache) {
+  MeasureResizeDenseGrid(/*cache=*/true,
+                         "ResizeDenseGridWithContributionCache");
+}
+
+// Appends paragraphs with floats to a long document with many floats, like a
+// news site with floated images which loads more articles, with and without
+// keeping the lowest float cache up to date incrementally.
+static void MeasureAppendParagraphsWithFloats(bool incremental,
+                                              const char* label) {
+  // Only legacy layout uses FloatingObjects.
+  ScopedLayoutNGForTest layout_ng(false);
+  ScopedIncrementalLowestFloatCacheForTest incremental_cache(incremental);
+
+  constexpr int kNumFloats = 2000;
+  constexpr int kParagraphsPerAppend = 10;
+  constexpr int kNumAppends = 50;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  // The floats are taller than their paragraphs, so that they overhang into
+  // the following ones and are added to the floats of the body.
+  document.body()->setInnerHTML(
+      "<style>"
+      "  span { width: 100px; height: 60px; }"
+      "  .left { float: left; }"
+      "  .right { float: right; }"
+      "</style>"
+      "<div id=content>" +
+          ParagraphsWithFloats(kNumFloats) + "</div>",
+      ASSERT_NO_EXCEPTION);
+  Persistent<Element> content = document.getElementById("content");
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumAppends; ++i) {
+    content->insertAdjacentHTML("beforeend",
+                                ParagraphsWithFloats(kParagraphsPerAppend),
+                                ASSERT_NO_EXCEPTION);
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("AppendTime", "us");
+  reporter.AddResult("AppendTime", timer.Elapsed());
+}
+
+TEST(LayoutPerfTest, AppendParagraphsWithFloats) {
+  MeasureAppendParagraphsWithFloats(/*incremental=*/false,
+                                    "AppendParagraphsWithFloats");
+}
+
+TEST(LayoutPerfTest, AppendParagraphsWithFloatsIncremental) {
+  MeasureAppendParagraphsWithFloats(/*incremental=*/true,
+                                    "AppendParagraphsWithFloatsIncremental");
+}
+
+// Balances the columns of a long article with column-count: 3 when it is
+// resized, with and without bisecting the initial column height.
+static void MeasureResizeMulticolArticle(bool bisect, const char* label) {
+  // LayoutNG block fragmentation does not use the ColumnBalancer.
+  ScopedLayoutNGBlockFragmentationForTest layout_ng_block_fragmentation(false);
+  ScopedBisectedColumnBalancingForTest bisected_column_balancing(bisect);
+
+  constexpr int kNumParagraphs = 500;
+  constexpr int kNumResizes = 50;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  document.body()->setInnerHTML(MulticolArticle(kNumParagraphs),
+                                ASSERT_NO_EXCEPTION);
+  Persistent<Element> article = document.getElementById("article");
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumResizes; ++i) {
+    // Each width rewraps the lines, so the columns need to be rebalanced.
+    StringBuilder style;
+    style.Append("column-count: 3; width: ");
+    style.AppendNumber(600 + i * 3);
+    style.Append("px");
+    article->setAttribute(html_names::kStyleAttr, style.ToAtomicString());
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("ResizeTime", "us");
+  reporter.AddResult("ResizeTime", timer.Elapsed());
+}
+
+TEST(LayoutPerfTest, ResizeMulticolArticle) {
+  MeasureResizeMulticolArticle(/*bisect=*/false, "ResizeMulticolArticle");
+}
+
+TEST(LayoutPerfTest, ResizeMulticolArticleBisected) {
+  MeasureResizeMulticolArticle(/*bisect=*/true,
+                               "ResizeMulticolArticleBisected");
+}
+
+// Lays out a dashboard of many contain: strict widgets, which are all updated
+// every frame, with and without skipping the repeated scroll anchor
+// notifications before each of their layout subtree roots.
+static void MeasureUpdateWidgets(bool skip_repeated_notifications,
+                                 const char* label) {
+  ScopedSkipRepeatedScrollAnchorNotificationsForTest
+      skip_repeated_scroll_anchor_notifications(skip_repeated_notifications);
+
+  constexpr int kNumWidgets = 200;
+  constexpr int kItemsPerWidget = 20;
+  constexpr int kNumFrames = 100;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  document.body()->setInnerHTML(Dashboard(kNumWidgets, kItemsPerWidget),
+                                ASSERT_NO_EXCEPTION);
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  // Scroll every widget, so that each of them has a scroll anchor to be
+  // notified before layout.
+  Persistent<HeapVector<Member<Element>>> widgets =
+      MakeGarbageCollected<HeapVector<Member<Element>>>();
+  for (Element* widget = document.body()->firstElementChild(); widget;
+       widget = widget->nextElementSibling()) {
+    if (!widget->HasClass())
+      continue;
+    widget->setScrollTop(50);
+    widgets->push_back(widget);
+  }
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumFrames; ++i) {
+    // Update the last item of each widget, so that each of them is scheduled
+    // as a layout subtree root.
+    for (Element* widget : *widgets) {
+      To<Text>(widget->lastElementChild()->firstChild())
+          ->setData(i % 2 ? "item" : "updated item");
+    }
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("FrameTime", "us");
+  reporter.AddResult("FrameTime", timer.Elapsed() / kNumFrames);
+}
+
+TEST(LayoutPerfTest, UpdateWidgets) {
+  MeasureUpdateWidgets(/*skip_repeated_notifications=*/false,
+                       "UpdateWidgets");
+}
+
+TEST(LayoutPerfTest, UpdateWidgetsSkippingRepeatedNotifications) {
+  MeasureUpdateWidgets(/*skip_repeated_notifications=*/true,
+                       "UpdateWidgetsSkippingRepeatedNotifications");
+}
+
+// Selects scroll anchors in a long feed which is scrolled while new items are
+// prepended.
+TEST(LayoutPerfTest, ScrollFeedWhilePrepending) {
+  constexpr int kNumItems = 10000;
+  constexpr int kNumFrames = 200;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout",
+                                                "ScrollFeedWhilePrepending");
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+
+  StringBuilder html;
+  html.Append("<style> .item { height: 50px } </style><div id=feed>");
+  for (int i = 0; i < kNumItems; ++i)
+    html.Append("<div class=item>item</div>");
+  html.Append("</div>");
+  document.body()->setInnerHTML(html.ToString(), ASSERT_NO_EXCEPTION);
+  Persistent<Element> feed = document.getElementById("feed");
+  Persistent<Element> scrolling_element = document.scrollingElement();
+  document.View()->UpdateAllLifecyclePhasesForTest();
+  scrolling_element->setScrollTop(kNumItems * 25);
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumFrames; ++i) {
+    // Scrolling clears the anchor, so that a new one is selected before the
+    // layout for the prepended item.
+    scrolling_element->setScrollTop(scrolling_element->scrollTop() + 10);
+    feed->insertAdjacentHTML("afterbegin", "<div class=item>new item</div>",
+                             ASSERT_NO_EXCEPTION);
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("FrameTime", "us");
+  reporter.AddResult("FrameTime", timer.Elapsed() / kNumFrames);
+}
+
+// Autosizes a long article with a growing list of short comments, which all
+// belong to one supercluster, with and without keeping the text lengths of
+// the clusters across layouts.
+static void MeasureAppendComments(bool incremental, const char* label) {
+  ScopedIncrementalTextAutosizerClustersForTest incremental_clusters(
+      incremental);
+
+  constexpr int kNumParagraphs = 200;
+  constexpr int kNumComments = 1000;
+  constexpr int kCommentsPerAppend = 10;
+  constexpr int kNumAppends = 50;
+
+  auto reporter = perf_test::PerfResultReporter("BlinkLayout", label);
+  auto page = CreatePage();
+  Document& document = page->GetDocument();
+  document.GetSettings()->SetTextAutosizingEnabled(true);
+  document.GetSettings()->SetTextAutosizingWindowSizeOverride(
+      gfx::Size(320, 480));
+
+  document.body()->setInnerHTML(
+      ArticleWithComments(kNumParagraphs, kNumComments), ASSERT_NO_EXCEPTION);
+  Persistent<Element> comments = document.getElementById("comments");
+  document.View()->UpdateAllLifecyclePhasesForTest();
+
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kNumAppends; ++i) {
+    // Each appended comment joins the supercluster of the comments, which is
+    // checked for enough text to autosize at the start of the next layout.
+    comments->insertAdjacentHTML("beforeend", Comments(kCommentsPerAppend),
+                                 ASSERT_NO_EXCEPTION);
+    document.View()->UpdateAllLifecyclePhasesForTest();
+  }
+  reporter.RegisterImportantMetric("AppendTime", "us");
+  reporter.AddResult("AppendTime", timer.Elapsed());
+}
+
+TEST(LayoutPerfTest, AppendComments) {
+  MeasureAppendComments(/*incremental=*/false, "AppendComments");
+}
+
+TEST(LayoutPerfTest, AppendCommentsIncremental) {
+  MeasureAppendComments(/*incremental=*/true, "AppendCommentsIncremental");
+}
+
+}  // namespace blink
@@ -3,12 +3,27 @@
 // found in the LICENSE file.
 
 #include "third_party/blink/renderer/core/layout/layout_shift_region.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
 
 namespace blink {
 
 namespace {
 
+// The number of rects at the end of the region which CoalesceRect looks at.
+// The rects of boxes which shift together are usually added one after the
+// other, with their old and new rects interleaved.
+constexpr wtf_size_t kCoalesceWindow = 4;
+
+// Whether the union of the two rects is a rect.
+bool UnionIsRect(const gfx::Rect& a, const gfx::Rect& b) {
+  if (a.x() == b.x() && a.width() == b.width())
+    return a.y() <= b.bottom() && b.y() <= a.bottom();
+  if (a.y() == b.y() && a.height() == b.height())
+    return a.x() <= b.right() && b.x() <= a.right();
+  return a.Contains(b) || b.Contains(a);
+}
+
 // A segment is a contiguous range of one or more basic intervals.
 struct Segment {
   // These are the 0-based indexes into the basic intervals, of the first and
@@ -309,6 +324,30 @@ uint64_t Sweeper::SweepImpl(SegmentTree& tree,
 
 }  // namespace
 
+void LayoutShiftRegion::AddRect(const gfx::Rect& rect) {
+  if (rect.IsEmpty())
+    return;
+  if (RuntimeEnabledFeatures::CoalescedLayoutShiftRegionEnabled() &&
+      CoalesceRect(rect)) {
+    return;
+  }
+  rects_.push_back(rect);
+}
+
+bool LayoutShiftRegion::CoalesceRect(const gfx::Rect& rect) {
+  wtf_size_t end = rects_.size() > kCoalesceWindow
+                       ? rects_.size() - kCoalesceWindow
+                       : 0;
+  for (wtf_size_t i = rects_.size(); i > end; --i) {
+    gfx::Rect& existing = rects_[i - 1];
+    if (UnionIsRect(existing, rect)) {
+      existing.Union(rect);
+      return true;
+    }
+  }
+  return false;
+}
+
 uint64_t LayoutShiftRegion::Area() const {
   if (rects_.IsEmpty())
     return 0;
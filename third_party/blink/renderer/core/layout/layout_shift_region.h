@@ -31,15 +31,18 @@ namespace blink {
 //
 // There are some subtleties to the segment tree, which are described by the
 // comments in the implementation.
+//
+// With the CoalescedLayoutShiftRegion feature, AddRect merges a rect into one
+// of the last few rects when one contains the other, or when they are stacked
+// or side by side with the same extent, so that their union is a rect. This
+// keeps the region exact, but the number of rects stays small when the boxes
+// of a big list or grid shift together.
 
 class CORE_EXPORT LayoutShiftRegion {
   DISALLOW_NEW();
 
  public:
-  void AddRect(const gfx::Rect& rect) {
-    if (!rect.IsEmpty())
-      rects_.push_back(rect);
-  }
+  void AddRect(const gfx::Rect& rect);
 
   const Vector<gfx::Rect>& GetRects() const { return rects_; }
   bool IsEmpty() const { return rects_.IsEmpty(); }
@@ -48,6 +51,9 @@ class CORE_EXPORT LayoutShiftRegion {
   uint64_t Area() const;
 
  private:
+  // Returns true if |rect| was merged into one of the last rects.
+  bool CoalesceRect(const gfx::Rect& rect);
+
   Vector<gfx::Rect> rects_;
 };
 
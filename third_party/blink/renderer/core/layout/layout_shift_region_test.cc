@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 #include "cc/base/region.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -123,4 +124,60 @@ TEST_F(LayoutShiftRegionTest, Waffle) {
   EXPECT_EQ(area, region.Area());
 }
 
+TEST_F(LayoutShiftRegionTest, Coalesced) {
+  ScopedCoalescedLayoutShiftRegionForTest coalesced(true);
+  LayoutShiftRegion region;
+
+  // Contained and identical rects.
+  region.AddRect(gfx::Rect(0, 0, 10, 10));
+  region.AddRect(gfx::Rect(2, 2, 5, 5));
+  region.AddRect(gfx::Rect(0, 0, 10, 10));
+  EXPECT_EQ(1u, region.GetRects().size());
+  EXPECT_EQ(100u, region.Area());
+
+  // A rect which contains the previous one replaces it.
+  region.AddRect(gfx::Rect(0, 0, 20, 10));
+  EXPECT_EQ(1u, region.GetRects().size());
+  EXPECT_EQ(200u, region.Area());
+
+  // Overlapping rects whose union is not a rect are kept.
+  region.AddRect(gfx::Rect(15, 5, 10, 10));
+  EXPECT_EQ(2u, region.GetRects().size());
+  EXPECT_EQ(275u, region.Area());
+}
+
+// The old and new rects of the items of a list which moves down by 25px.
+TEST_F(LayoutShiftRegionTest, CoalescedShiftedList) {
+  LayoutShiftRegion region;
+  LayoutShiftRegion coalesced_region;
+  for (int i = 0; i < 1000; i++) {
+    gfx::Rect old_rect(10, i * 20, 300, 20);
+    gfx::Rect new_rect(10, i * 20 + 25, 300, 20);
+    region.AddRect(old_rect);
+    region.AddRect(new_rect);
+    ScopedCoalescedLayoutShiftRegionForTest coalesced(true);
+    coalesced_region.AddRect(old_rect);
+    coalesced_region.AddRect(new_rect);
+  }
+  EXPECT_EQ(2000u, region.GetRects().size());
+  // The first old rect, and everything else.
+  EXPECT_EQ(2u, coalesced_region.GetRects().size());
+  EXPECT_EQ(region.Area(), coalesced_region.Area());
+  EXPECT_EQ(300u * 20025u, coalesced_region.Area());
+
+  // A list with gaps between the items.
+  region.Reset();
+  coalesced_region.Reset();
+  for (int i = 0; i < 1000; i++) {
+    gfx::Rect old_rect(10, i * 30, 300, 20);
+    gfx::Rect new_rect(20, i * 30 + 5, 300, 20);
+    region.AddRect(old_rect);
+    region.AddRect(new_rect);
+    ScopedCoalescedLayoutShiftRegionForTest coalesced(true);
+    coalesced_region.AddRect(old_rect);
+    coalesced_region.AddRect(new_rect);
+  }
+  EXPECT_EQ(region.Area(), coalesced_region.Area());
+}
+
 }  // namespace blink
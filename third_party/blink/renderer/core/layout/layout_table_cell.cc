@@ -79,6 +79,7 @@ void LayoutTableCell::WillBeRemovedFromTree() {
   LayoutBlockFlow::WillBeRemovedFromTree();
 
   Section()->SetNeedsCellRecalc();
+  IntrinsicLogicalWidthsChanged();
 
   // When borders collapse, removing a cell can affect the the width of
   // neighboring cells.
@@ -126,6 +127,17 @@ void LayoutTableCell::UpdateColAndRowSpanFlags() {
   has_row_span_ = GetNode() && ParseRowSpanFromDOM() != 1;
 }
 
+void LayoutTableCell::IntrinsicLogicalWidthsChanged() const {
+  NOT_DESTROYED();
+  // Rows which are not in a section yet will get their index when they are
+  // inserted, and LayoutTableSection::AddChild() takes care of them.
+  auto* row = DynamicTo<LayoutTableRow>(Parent());
+  if (!row || !row->RowIndexWasSet())
+    return;
+  if (auto* section = DynamicTo<LayoutTableSection>(row->Parent()))
+    section->SetCellWidthsChangedInRow(row->RowIndex());
+}
+
 void LayoutTableCell::ColSpanOrRowSpanChanged() {
   NOT_DESTROYED();
   DCHECK(GetNode());
@@ -118,6 +118,10 @@ class CORE_EXPORT LayoutTableCell : public LayoutBlockFlow,
   // Called from HTMLTableCellElement.
   void ColSpanOrRowSpanChanged() final;
 
+  // Called when the intrinsic logical widths of the cell become dirty, or when
+  // the cell is removed, to let the section know about the changed row.
+  void IntrinsicLogicalWidthsChanged() const;
+
   void SetAbsoluteColumnIndex(unsigned column) {
     NOT_DESTROYED();
     CHECK_LE(column, kMaxColumnIndex);
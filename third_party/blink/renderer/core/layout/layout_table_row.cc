@@ -50,6 +50,7 @@ void LayoutTableRow::WillBeRemovedFromTree() {
   LayoutTableBoxComponent::WillBeRemovedFromTree();
 
   Section()->SetNeedsCellRecalc();
+  Section()->SetCellWidthsChangedInRow(RowIndexWasSet() ? RowIndex() : 0);
 }
 
 LayoutNGTableCellInterface* LayoutTableRow::FirstCellInterface() const {
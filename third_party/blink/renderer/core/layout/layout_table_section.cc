@@ -98,6 +98,7 @@ LayoutTableSection::LayoutTableSection(Element* element)
       c_col_(0),
       c_row_(0),
       needs_cell_recalc_(false),
+      first_row_with_changed_cell_widths_(0),
       force_full_paint_(false),
       has_multiple_cell_levels_(false),
       has_spanning_cells_(false),
@@ -207,8 +208,11 @@ void LayoutTableSection::AddChild(LayoutObject* child,
     return;
   }
 
-  if (before_child)
+  if (before_child) {
     SetNeedsCellRecalc();
+    // The rows after the new one move down, so this is not an append.
+    SetCellWidthsChangedInRow(0);
+  }
 
   unsigned insertion_row = c_row_;
   ++c_row_;
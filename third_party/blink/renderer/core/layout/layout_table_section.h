@@ -26,6 +26,8 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_LAYOUT_TABLE_SECTION_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_LAYOUT_TABLE_SECTION_H_
 
+#include <limits>
+
 #include "base/notreached.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/layout/layout_table.h"
@@ -240,6 +242,23 @@ class CORE_EXPORT LayoutTableSection final
   }
   void SetNeedsCellRecalc() final;
 
+  // The first row in which cells were added, removed or changed their
+  // intrinsic logical widths since ClearRowsWithChangedCellWidths(). Used by
+  // TableLayoutAlgorithmAuto to only recalc the columns for appended rows.
+  unsigned FirstRowWithChangedCellWidths() const {
+    NOT_DESTROYED();
+    return first_row_with_changed_cell_widths_;
+  }
+  void SetCellWidthsChangedInRow(unsigned row) {
+    NOT_DESTROYED();
+    first_row_with_changed_cell_widths_ =
+        std::min(first_row_with_changed_cell_widths_, row);
+  }
+  void ClearRowsWithChangedCellWidths() {
+    NOT_DESTROYED();
+    first_row_with_changed_cell_widths_ = std::numeric_limits<unsigned>::max();
+  }
+
   LayoutUnit RowBaseline(unsigned row) {
     NOT_DESTROYED();
     return grid_[row].baseline;
@@ -533,6 +552,9 @@ class CORE_EXPORT LayoutTableSection final
 
   bool needs_cell_recalc_;
 
+  // See FirstRowWithChangedCellWidths().
+  unsigned first_row_with_changed_cell_widths_;
+
   // This HashSet holds the overflowing cells for the partial paint path. If we
   // have too many overflowing cells, it will be empty and force_full_paint_
   // will be set to save memory. See ComputeVisualOverflowFromDescendants().
@@ -5,7 +5,10 @@
 #include "third_party/blink/renderer/core/layout/layout_table.h"
 #include "third_party/blink/renderer/core/layout/layout_table_section.h"
 
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -437,6 +440,154 @@ TEST_F(LayoutTableTest, HasNonCollapsedBorderDecoration) {
   EXPECT_FALSE(table->HasNonCollapsedBorderDecoration());
 }
 
+TEST_F(LayoutTableTest, IncrementalColumnRecalcForAppendedRows) {
+  // TablesNG does not use TableLayoutAlgorithmAuto.
+  if (RuntimeEnabledFeatures::LayoutNGEnabled())
+    return;
+
+  ScopedIncrementalTableColumnRecalcForTest incremental_recalc(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      td { padding: 0; }
+      div { height: 10px; }
+    </style>
+    <table id='incremental' cellspacing='0'>
+      <tbody id='body'>
+        <tr><td><div style='width: 20px'></div></td><td>
+          <div style='width: 30px'></div></td></tr>
+      </tbody>
+    </table>
+    <table id='reference' cellspacing='0'>
+      <tbody>
+        <tr><td><div style='width: 20px'></div></td><td>
+          <div style='width: 30px'></div></td></tr>
+        <tr><td><div style='width: 50px'></div></td><td>
+          <div style='width: 10px'></div></td></tr>
+        <tr><td><div style='width: 40px'></div></td><td width='45'>
+          <div style='width: 40px'></div></td></tr>
+      </tbody>
+    </table>
+  )HTML");
+  auto* table = GetTableByElementId("incremental");
+  EXPECT_EQ(50, table->OffsetWidth());
+
+  Element* body = GetElementById("body");
+  body->insertAdjacentHTML("beforeend", R"HTML(
+    <tr><td><div style='width: 50px'></div></td><td>
+      <div style='width: 10px'></div></td></tr>
+    <tr><td><div style='width: 40px'></div></td><td width='45'>
+      <div style='width: 40px'></div></td></tr>
+  )HTML", ASSERT_NO_EXCEPTION);
+  UpdateAllLifecyclePhasesForTest();
+  auto* reference = GetTableByElementId("reference");
+  EXPECT_EQ(95, reference->OffsetWidth());
+  EXPECT_EQ(reference->OffsetWidth(), table->OffsetWidth());
+
+  // Changing a cell which was already there goes back to a full recalc, which
+  // also handles a narrower cell.
+  Element* first_div =
+      body->firstElementChild()->firstElementChild()->firstElementChild();
+  first_div->setAttribute(html_names::kStyleAttr, "width: 80px");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(125, table->OffsetWidth());
+  body->firstElementChild()->remove();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(reference->OffsetWidth(), table->OffsetWidth());
+}
+
+TEST_F(LayoutTableTest, IncrementalColumnRecalcForRowSpanningColSpanCell) {
+  // TablesNG does not use TableLayoutAlgorithmAuto.
+  if (RuntimeEnabledFeatures::LayoutNGEnabled())
+    return;
+
+  ScopedIncrementalTableColumnRecalcForTest incremental_recalc(true);
+  // The spanning cell starts in the last row before the append, and spans
+  // into the appended rows.
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      td { padding: 0; }
+      div { height: 10px; }
+    </style>
+    <table id='incremental' cellspacing='0'>
+      <tbody id='body'>
+        <tr><td id='incremental-cell'><div style='width: 20px'></div></td><td>
+          <div style='width: 30px'></div></td><td></td></tr>
+        <tr><td colspan='2' rowspan='3'><div style='width: 90px'></div></td>
+          <td><div style='width: 10px'></div></td></tr>
+      </tbody>
+    </table>
+    <table id='reference' cellspacing='0'>
+      <tbody>
+        <tr><td id='reference-cell'><div style='width: 20px'></div></td><td>
+          <div style='width: 30px'></div></td><td></td></tr>
+        <tr><td colspan='2' rowspan='3'><div style='width: 90px'></div></td>
+          <td><div style='width: 10px'></div></td></tr>
+        <tr><td><div style='width: 40px'></div></td></tr>
+        <tr><td><div style='width: 15px'></div></td></tr>
+      </tbody>
+    </table>
+  )HTML");
+  auto* table = GetTableByElementId("incremental");
+  EXPECT_EQ(100, table->OffsetWidth());
+
+  Element* body = GetElementById("body");
+  body->insertAdjacentHTML("beforeend", R"HTML(
+    <tr><td><div style='width: 40px'></div></td></tr>
+    <tr><td><div style='width: 15px'></div></td></tr>
+  )HTML", ASSERT_NO_EXCEPTION);
+  UpdateAllLifecyclePhasesForTest();
+  auto* reference = GetTableByElementId("reference");
+  EXPECT_EQ(130, reference->OffsetWidth());
+  EXPECT_EQ(reference->OffsetWidth(), table->OffsetWidth());
+  // The spanning cell is distributed over its columns in the same way.
+  EXPECT_EQ(GetLayoutBoxByElementId("reference-cell")->OffsetWidth(),
+            GetLayoutBoxByElementId("incremental-cell")->OffsetWidth());
+}
+
+TEST_F(LayoutTableTest, IncrementalColumnRecalcAfterOldRowsChanged) {
+  // TablesNG does not use TableLayoutAlgorithmAuto.
+  if (RuntimeEnabledFeatures::LayoutNGEnabled())
+    return;
+
+  ScopedIncrementalTableColumnRecalcForTest incremental_recalc(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>
+      td { padding: 0; }
+      div { height: 10px; }
+    </style>
+    <table id='table' cellspacing='0'>
+      <tbody id='body'>
+        <tr><td><div style='width: 20px'></div></td><td>
+          <div style='width: 30px'></div></td></tr>
+        <tr id='second'><td id='removed'><div style='width: 50px'></div></td>
+          <td><div style='width: 10px'></div></td></tr>
+      </tbody>
+    </table>
+  )HTML");
+  auto* table = GetTableByElementId("table");
+  EXPECT_EQ(80, table->OffsetWidth());
+
+  Element* body = GetElementById("body");
+  body->insertAdjacentHTML("beforeend", R"HTML(
+    <tr><td><div style='width: 40px'></div></td><td>
+      <div style='width: 60px'></div></td></tr>
+  )HTML", ASSERT_NO_EXCEPTION);
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(110, table->OffsetWidth());
+
+  // Removing a cell from a row which was already there needs a full recalc.
+  GetElementById("removed")->remove();
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(100, table->OffsetWidth());
+
+  // So does inserting a row before the others.
+  body->insertAdjacentHTML("afterbegin", R"HTML(
+    <tr><td><div style='width: 70px'></div></td></tr>
+  )HTML", ASSERT_NO_EXCEPTION);
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(130, table->OffsetWidth());
+}
+
 }  // anonymous namespace
 
 }  // namespace blink
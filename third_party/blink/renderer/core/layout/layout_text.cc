@@ -91,12 +91,11 @@ namespace {
 
 struct SameSizeAsLayoutText : public LayoutObject {
   uint32_t bitfields : 12;
-  DOMNodeId node_id;
+  wtf_size_t first_fragment_item_index_;
   float widths[4];
   String text;
   Member<void*> members[2];
   PhysicalOffset previous_starting_point;
-  wtf_size_t first_fragment_item_index_;
 };
 
 ASSERT_SIZE(LayoutText, SameSizeAsLayoutText);
@@ -161,6 +160,15 @@ SelectionDisplayItemClientMap& GetSelectionDisplayItemClientMap() {
   return *map;
 }
 
+// Only the LayoutTexts captured by ContentCaptureManager have a DOMNodeId, so
+// it is kept out of LayoutText.
+using NodeIdMap = HeapHashMap<WeakMember<const LayoutText>, DOMNodeId>;
+NodeIdMap& GetNodeIdMap() {
+  DEFINE_STATIC_LOCAL(Persistent<NodeIdMap>, map,
+                      (MakeGarbageCollected<NodeIdMap>()));
+  return *map;
+}
+
 }  // anonymous namespace
 
 LayoutText::LayoutText(Node* node, scoped_refptr<StringImpl> str)
@@ -175,6 +183,7 @@ LayoutText::LayoutText(Node* node, scoped_refptr<StringImpl> str)
           static_cast<unsigned>(OnlyWhitespaceOrNbsp::kUnknown)),
       is_text_fragment_(false),
       has_abstract_inline_text_box_(false),
+      has_node_id_(false),
       min_width_(-1),
       max_width_(-1),
       first_line_min_width_(0),
@@ -257,9 +266,12 @@ void LayoutText::StyleDidChange(StyleDifference diff,
   if (!GetText().ContainsOnlyWhitespaceOrEmpty())
     new_style.GetFont().WillUseFontData(GetText());
 
-  TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer();
-  if (!old_style && text_autosizer)
-    text_autosizer->Record(this);
+  if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer()) {
+    if (!old_style)
+      text_autosizer->Record(this);
+    else if (old_style->SpecifiedFontSize() != new_style.SpecifiedFontSize())
+      text_autosizer->SpecifiedFontSizeChanged(this);
+  }
 
   if (diff.NeedsReshape()) {
     valid_ng_items_ = false;
@@ -304,12 +316,16 @@ void LayoutText::WillBeDestroyed() {
 
   GetSelectionDisplayItemClientMap().erase(this);
 
-  if (node_id_ != kInvalidDOMNodeId) {
+  if (has_node_id_) {
     if (auto* manager = GetOrResetContentCaptureManager())
       manager->OnLayoutTextWillBeDestroyed(*GetNode());
-    node_id_ = kInvalidDOMNodeId;
+    GetNodeIdMap().erase(this);
+    has_node_id_ = false;
   }
 
+  if (TextAutosizer* text_autosizer = GetDocument().GetTextAutosizer())
+    text_autosizer->Destroy(this);
+
   RemoveAndDestroyTextBoxes();
   LayoutObject::WillBeDestroyed();
   valid_ng_items_ = false;
@@ -2829,15 +2845,23 @@ PhysicalRect LayoutText::DebugRect() const {
 
 DOMNodeId LayoutText::EnsureNodeId() {
   NOT_DESTROYED();
-  if (node_id_ == kInvalidDOMNodeId) {
-    if (auto* content_capture_manager = GetOrResetContentCaptureManager()) {
-      if (auto* node = GetNode()) {
-        content_capture_manager->ScheduleTaskIfNeeded(*node);
-        node_id_ = DOMNodeIds::IdForNode(node);
-      }
+  if (has_node_id_)
+    return GetNodeIdMap().at(this);
+  if (auto* content_capture_manager = GetOrResetContentCaptureManager()) {
+    if (auto* node = GetNode()) {
+      content_capture_manager->ScheduleTaskIfNeeded(*node);
+      DOMNodeId node_id = DOMNodeIds::IdForNode(node);
+      GetNodeIdMap().Set(this, node_id);
+      has_node_id_ = true;
+      return node_id;
     }
   }
-  return node_id_;
+  return kInvalidDOMNodeId;
+}
+
+// static
+wtf_size_t LayoutText::NodeIdCountForTesting() {
+  return GetNodeIdMap().size();
 }
 
 ContentCaptureManager* LayoutText::GetOrResetContentCaptureManager() {
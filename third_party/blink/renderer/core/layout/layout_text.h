@@ -372,8 +372,10 @@ class CORE_EXPORT LayoutText : public LayoutObject {
   DOMNodeId EnsureNodeId();
   bool HasNodeId() const {
     NOT_DESTROYED();
-    return node_id_ != kInvalidDOMNodeId;
+    return has_node_id_;
   }
+  // The number of LayoutTexts with a DOMNodeId in the side table.
+  static wtf_size_t NodeIdCountForTesting();
 
   void SetInlineItems(NGInlineItemsData* data, size_t begin, size_t size);
   void ClearInlineItems();
@@ -578,7 +580,16 @@ class CORE_EXPORT LayoutText : public LayoutObject {
   // associated to |NGAbstractInlineTextBox|.
   unsigned has_abstract_inline_text_box_ : 1;
 
-  DOMNodeId node_id_ = kInvalidDOMNodeId;
+  // True if a DOMNodeId for ContentCaptureManager is stored in the side table
+  // of this object, see EnsureNodeId().
+  unsigned has_node_id_ : 1;
+
+  // The index of the first fragment item associated with this object in
+  // |NGFragmentItems::Items()|. Zero means there are no such item.
+  // Valid only when IsInLayoutNGInlineFormattingContext().
+  // Declared after the bitfields so that it is packed with them instead of
+  // padding the end of the object.
+  wtf_size_t first_fragment_item_index_ = 0u;
 
   float min_width_;
   float max_width_;
@@ -595,11 +606,6 @@ class CORE_EXPORT LayoutText : public LayoutObject {
   // Read the LINE BOXES OWNERSHIP section in the class header comment.
   // Valid only when !IsInLayoutNGInlineFormattingContext().
   InlineTextBoxList text_boxes_;
-
-  // The index of the first fragment item associated with this object in
-  // |NGFragmentItems::Items()|. Zero means there are no such item.
-  // Valid only when IsInLayoutNGInlineFormattingContext().
-  wtf_size_t first_fragment_item_index_ = 0u;
 };
 
 inline InlineTextBoxList& LayoutText::MutableTextBoxes() {
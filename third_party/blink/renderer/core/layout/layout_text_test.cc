@@ -8,12 +8,16 @@
 #include "build/build_config.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/web/web_content_capture_client.h"
+#include "third_party/blink/public/web/web_content_holder.h"
+#include "third_party/blink/renderer/core/dom/dom_node_ids.h"
 #include "third_party/blink/renderer/core/dom/pseudo_element.h"
 #include "third_party/blink/renderer/core/editing/frame_selection.h"
 #include "third_party/blink/renderer/core/editing/position_with_affinity.h"
 #include "third_party/blink/renderer/core/editing/selection_template.h"
 #include "third_party/blink/renderer/core/editing/testing/selection_sample.h"
 #include "third_party/blink/renderer/core/layout/line/inline_text_box.h"
+#include "third_party/blink/renderer/core/loader/empty_clients.h"
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/testing/font_test_helpers.h"
@@ -125,6 +129,35 @@ class ParameterizedLayoutTextTest : public testing::WithParamInterface<bool>,
 
 INSTANTIATE_TEST_SUITE_P(All, ParameterizedLayoutTextTest, testing::Bool());
 
+class TestWebContentCaptureClient : public WebContentCaptureClient {
+ public:
+  base::TimeDelta GetTaskInitialDelay() const override {
+    return base::Milliseconds(500);
+  }
+  void DidCaptureContent(const WebVector<WebContentHolder>& data,
+                         bool first_data) override {}
+  void DidUpdateContent(const WebVector<WebContentHolder>& data) override {}
+  void DidRemoveContent(WebVector<int64_t> data) override {}
+};
+
+class ContentCaptureLocalFrameClient : public EmptyLocalFrameClient {
+ public:
+  WebContentCaptureClient* GetWebContentCaptureClient() const override {
+    return &content_capture_client_;
+  }
+
+ private:
+  mutable TestWebContentCaptureClient content_capture_client_;
+};
+
+// LayoutTexts only get a DOMNodeId when the frame has a content capture
+// client, which creates a ContentCaptureManager.
+class LayoutTextNodeIdTest : public RenderingTest {
+ public:
+  LayoutTextNodeIdTest()
+      : RenderingTest(MakeGarbageCollected<ContentCaptureLocalFrameClient>()) {}
+};
+
 }  // namespace
 
 TEST_F(LayoutTextTest, WidthZeroFromZeroLength) {
@@ -1452,4 +1485,66 @@ TEST_P(ParameterizedLayoutTextTest, FloatFirstLetterPlainText) {
   EXPECT_EQ("Foo", text->PlainText());
 }
 
+TEST_F(LayoutTextTest, NoNodeIdWithoutContentCaptureManager) {
+  SetBasicBody("foo");
+  LayoutText* text = GetBasicText();
+  EXPECT_EQ(kInvalidDOMNodeId, text->EnsureNodeId());
+  EXPECT_FALSE(text->HasNodeId());
+}
+
+TEST_F(LayoutTextNodeIdTest, EnsureNodeId) {
+  SetBodyInnerHTML("<div id=first>foo</div><div id=second>bar</div>");
+  wtf_size_t initial_count = LayoutText::NodeIdCountForTesting();
+  LayoutText* first =
+      To<LayoutText>(GetLayoutObjectByElementId("first")->SlowFirstChild());
+  LayoutText* second =
+      To<LayoutText>(GetLayoutObjectByElementId("second")->SlowFirstChild());
+  EXPECT_FALSE(first->HasNodeId());
+  EXPECT_FALSE(second->HasNodeId());
+
+  DOMNodeId first_id = first->EnsureNodeId();
+  EXPECT_EQ(DOMNodeIds::IdForNode(first->GetNode()), first_id);
+  EXPECT_TRUE(first->HasNodeId());
+  EXPECT_FALSE(second->HasNodeId());
+  EXPECT_EQ(initial_count + 1, LayoutText::NodeIdCountForTesting());
+
+  // The DOMNodeId is kept in the side table.
+  EXPECT_EQ(first_id, first->EnsureNodeId());
+  EXPECT_EQ(initial_count + 1, LayoutText::NodeIdCountForTesting());
+
+  DOMNodeId second_id = second->EnsureNodeId();
+  EXPECT_EQ(DOMNodeIds::IdForNode(second->GetNode()), second_id);
+  EXPECT_NE(first_id, second_id);
+  EXPECT_EQ(initial_count + 2, LayoutText::NodeIdCountForTesting());
+}
+
+TEST_F(LayoutTextNodeIdTest, WillBeDestroyedRemovesNodeId) {
+  SetBodyInnerHTML("<div id=first>foo</div><div id=second>bar</div>");
+  wtf_size_t initial_count = LayoutText::NodeIdCountForTesting();
+  LayoutText* first =
+      To<LayoutText>(GetLayoutObjectByElementId("first")->SlowFirstChild());
+  LayoutText* second =
+      To<LayoutText>(GetLayoutObjectByElementId("second")->SlowFirstChild());
+  first->EnsureNodeId();
+  DOMNodeId second_id = second->EnsureNodeId();
+  EXPECT_EQ(initial_count + 2, LayoutText::NodeIdCountForTesting());
+
+  // Destroying a LayoutText removes its entry, without waiting for the
+  // garbage collector, and leaves the other entries alone.
+  Element* first_element = GetElementById("first");
+  first_element->SetInlineStyleProperty(CSSPropertyID::kDisplay, "none");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_EQ(initial_count + 1, LayoutText::NodeIdCountForTesting());
+  EXPECT_TRUE(second->HasNodeId());
+  EXPECT_EQ(second_id, second->EnsureNodeId());
+
+  // The new LayoutText of the text starts without an entry.
+  first_element->RemoveInlineStyleProperty(CSSPropertyID::kDisplay);
+  UpdateAllLifecyclePhasesForTest();
+  LayoutText* new_first =
+      To<LayoutText>(GetLayoutObjectByElementId("first")->SlowFirstChild());
+  EXPECT_FALSE(new_first->HasNodeId());
+  EXPECT_EQ(initial_count + 1, LayoutText::NodeIdCountForTesting());
+}
+
 }  // namespace blink
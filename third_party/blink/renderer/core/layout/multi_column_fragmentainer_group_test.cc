@@ -6,9 +6,11 @@
 
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/core/css/resolver/style_resolver.h"
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/layout/layout_multi_column_flow_thread.h"
 #include "third_party/blink/renderer/core/layout/layout_multi_column_set.h"
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -27,6 +29,17 @@ class MultiColumnFragmentainerGroupTest : public RenderingTest {
 
   static int GroupCount(const MultiColumnFragmentainerGroupList&);
 
+  // Returns the heights of the fragmentainer groups of the multicol container
+  // with the given id.
+  Vector<LayoutUnit> GroupHeights(const char* id);
+
+  // Lays out |html| with and without bisecting the initial column height, and
+  // expects the same heights of the fragmentainer groups of each multicol
+  // container in |ids|. Bisecting should only save layout passes.
+  void ExpectSameBalancedHeights(const String& html,
+                                 std::initializer_list<const char*> ids,
+                                 const char* resized_style = nullptr);
+
  private:
   Persistent<LayoutMultiColumnFlowThread> flow_thread_;
   Persistent<LayoutMultiColumnSet> column_set_;
@@ -58,6 +71,48 @@ int MultiColumnFragmentainerGroupTest::GroupCount(
   return count;
 }
 
+Vector<LayoutUnit> MultiColumnFragmentainerGroupTest::GroupHeights(
+    const char* id) {
+  Vector<LayoutUnit> heights;
+  const auto* multicol = GetLayoutObjectByElementId(id);
+  for (const LayoutObject* child = multicol->SlowFirstChild(); child;
+       child = child->NextSibling()) {
+    const auto* column_set = DynamicTo<LayoutMultiColumnSet>(child);
+    if (!column_set)
+      continue;
+    for (const auto& group : column_set->FragmentainerGroups())
+      heights.push_back(group.GroupLogicalHeight());
+  }
+  return heights;
+}
+
+void MultiColumnFragmentainerGroupTest::ExpectSameBalancedHeights(
+    const String& html,
+    std::initializer_list<const char*> ids,
+    const char* resized_style) {
+  // Disable LayoutNGBlockFragmentation, so that multicol uses legacy layout.
+  ScopedLayoutNGBlockFragmentationForTest layout_ng_block_fragmentation(false);
+
+  Vector<LayoutUnit> heights[2];
+  for (bool bisect : {false, true}) {
+    ScopedBisectedColumnBalancingForTest bisected_column_balancing(bisect);
+    SetBodyInnerHTML(html);
+    // Relayout with a new style of the first multicol container, when the
+    // content has pagination struts from the previous layout.
+    if (resized_style) {
+      GetElementById(*ids.begin())
+          ->setAttribute(html_names::kStyleAttr, resized_style);
+      UpdateAllLifecyclePhasesForTest();
+    }
+    for (const char* id : ids) {
+      Vector<LayoutUnit> group_heights = GroupHeights(id);
+      EXPECT_FALSE(group_heights.IsEmpty()) << id;
+      heights[bisect].AppendVector(group_heights);
+    }
+  }
+  EXPECT_EQ(heights[false], heights[true]);
+}
+
 TEST_F(MultiColumnFragmentainerGroupTest, Create) {
   MultiColumnFragmentainerGroupList group_list(ColumnSet());
   EXPECT_EQ(GroupCount(group_list), 1);
@@ -192,6 +247,106 @@ TEST_F(MultiColumnFragmentainerGroupTest, NestedBlocksWithLotsOfContent) {
   EXPECT_EQ(overflow.Height(), LayoutUnit(60));
 }
 
+TEST_F(MultiColumnFragmentainerGroupTest, BisectedColumnBalancing) {
+  StringBuilder builder;
+  builder.Append(
+      "<div id='multicol' style='columns:3; column-gap:0; width:300px; "
+      "line-height:20px; orphans:1; widows:1;'>");
+  const int kLineCounts[] = {4, 1, 7, 3, 2, 9, 5};
+  for (int line_count : kLineCounts) {
+    builder.Append("<p style='margin:0 0 10px'>");
+    for (int i = 0; i < line_count; i++)
+      builder.Append("line<br>");
+    builder.Append("</p><img style='display:block; height:35px'>");
+  }
+  builder.Append("</div>");
+  ExpectSameBalancedHeights(builder.ToString(), {"multicol"});
+}
+
+TEST_F(MultiColumnFragmentainerGroupTest, BisectedColumnBalancingMargins) {
+  // Margins, borders and padding around the lines, which are not recorded as
+  // unbreakable pieces, and collapsing margins of nested blocks.
+  StringBuilder builder;
+  builder.Append(
+      "<div id='multicol' style='columns:3; column-gap:0; width:300px; "
+      "line-height:20px; orphans:1; widows:1;'>");
+  const int kLineCounts[] = {2, 5, 1, 6, 3, 4, 2, 7};
+  for (int line_count : kLineCounts) {
+    builder.Append(
+        "<div style='margin:17px 0 23px; border:3px solid; padding:9px 0'>"
+        "<div style='margin-top:11px'>");
+    for (int i = 0; i < line_count; i++)
+      builder.Append("line<br>");
+    builder.Append("</div></div>");
+  }
+  builder.Append("</div>");
+  ExpectSameBalancedHeights(builder.ToString(), {"multicol"});
+}
+
+TEST_F(MultiColumnFragmentainerGroupTest, BisectedColumnBalancingStruts) {
+  // Orphans, widows and blocks which avoid breaks inside, which push content
+  // further than the unbreakable pieces alone, first in the initial layout
+  // and then in a relayout with the pagination struts of the previous one.
+  StringBuilder builder;
+  builder.Append(
+      "<div id='multicol' style='columns:3; column-gap:0; width:300px; "
+      "line-height:20px; orphans:3; widows:2;'>");
+  const int kLineCounts[] = {5, 3, 8, 4, 6, 2, 7};
+  for (int line_count : kLineCounts) {
+    builder.Append(line_count % 2 ? "<p style='break-inside:avoid'>" : "<p>");
+    for (int i = 0; i < line_count; i++)
+      builder.Append("line<br>");
+    builder.Append("</p><img style='display:block; height:45px'>");
+  }
+  builder.Append("</div>");
+  ExpectSameBalancedHeights(builder.ToString(), {"multicol"});
+  ExpectSameBalancedHeights(
+      builder.ToString(), {"multicol"},
+      "columns:3; column-gap:0; width:240px; line-height:20px; orphans:3; "
+      "widows:2;");
+}
+
+TEST_F(MultiColumnFragmentainerGroupTest, BisectedColumnBalancingSpanners) {
+  // Each column set between the spanners is balanced separately.
+  StringBuilder builder;
+  builder.Append(
+      "<div id='multicol' style='columns:3; column-gap:0; width:300px; "
+      "line-height:20px; orphans:1; widows:1;'>");
+  const int kLineCounts[] = {7, 2, 11, 4};
+  for (int line_count : kLineCounts) {
+    builder.Append("<p style='margin:0 0 10px'>");
+    for (int i = 0; i < line_count; i++)
+      builder.Append("line<br>");
+    builder.Append(
+        "</p><img style='display:block; height:35px'>"
+        "<div style='column-span:all; height:15px'></div>");
+  }
+  builder.Append("</div>");
+  ExpectSameBalancedHeights(builder.ToString(), {"multicol"});
+}
+
+TEST_F(MultiColumnFragmentainerGroupTest,
+       BisectedColumnBalancingNestedFragmentation) {
+  // The inner multicol containers are balanced inside the columns of the
+  // outer one, which has a fixed height.
+  StringBuilder builder;
+  builder.Append(
+      "<div id='outer' style='columns:2; column-gap:0; width:600px; "
+      "height:150px; line-height:20px; orphans:1; widows:1;'>");
+  const int kLineCounts[] = {9, 14};
+  const char* kIds[] = {"inner1", "inner2"};
+  for (int i = 0; i < 2; i++) {
+    builder.Append("<div id='");
+    builder.Append(kIds[i]);
+    builder.Append("' style='columns:3; column-gap:0'>");
+    for (int j = 0; j < kLineCounts[i]; j++)
+      builder.Append("line<br>");
+    builder.Append("<img style='display:block; height:35px'></div>");
+  }
+  builder.Append("</div>");
+  ExpectSameBalancedHeights(builder.ToString(), {"outer", "inner1", "inner2"});
+}
+
 }  // anonymous namespace
 
 }  // namespace blink
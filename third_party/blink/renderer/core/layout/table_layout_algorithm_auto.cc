@@ -24,12 +24,14 @@
 #include "third_party/blink/renderer/core/layout/layout_table.h"
 #include "third_party/blink/renderer/core/layout/layout_table_cell.h"
 #include "third_party/blink/renderer/core/layout/layout_table_col.h"
+#include "third_party/blink/renderer/core/layout/layout_table_row.h"
 #include "third_party/blink/renderer/core/layout/layout_table_section.h"
 #include "third_party/blink/renderer/core/layout/layout_view.h"
 #include "third_party/blink/renderer/core/layout/ng/table/layout_ng_table_cell_interface.h"
 #include "third_party/blink/renderer/core/layout/ng/table/layout_ng_table_interface.h"
 #include "third_party/blink/renderer/core/layout/text_autosizer.h"
 #include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 
 namespace blink {
 
@@ -41,7 +43,10 @@ TableLayoutAlgorithmAuto::TableLayoutAlgorithmAuto(LayoutTable* table)
 
 TableLayoutAlgorithmAuto::~TableLayoutAlgorithmAuto() = default;
 
-void TableLayoutAlgorithmAuto::RecalcColumn(unsigned eff_col) {
+void TableLayoutAlgorithmAuto::RecalcColumn(
+    unsigned eff_col,
+    LayoutTableSection* appended_section,
+    unsigned first_appended_row) {
   Layout& column_layout = layout_struct_[eff_col];
 
   LayoutTableCell* fixed_contributor = nullptr;
@@ -57,8 +62,10 @@ void TableLayoutAlgorithmAuto::RecalcColumn(unsigned eff_col) {
       To<LayoutTableCol>(child)->ClearIntrinsicLogicalWidthsDirtyBits();
     } else if (child->IsTableSection()) {
       LayoutTableSection* section = To<LayoutTableSection>(child);
+      if (appended_section && section != appended_section)
+        continue;
       unsigned num_rows = section->NumRows();
-      for (unsigned i = 0; i < num_rows; i++) {
+      for (unsigned i = first_appended_row; i < num_rows; i++) {
         if (eff_col >= section->NumCols(i))
           continue;
         auto& grid_cell = section->GridCellAt(i, eff_col);
@@ -66,6 +73,9 @@ void TableLayoutAlgorithmAuto::RecalcColumn(unsigned eff_col) {
 
         if (grid_cell.InColSpan() || !cell)
           continue;
+        // Cells which span into the appended rows were already recalculated.
+        if (first_appended_row && cell->RowIndex() < first_appended_row)
+          continue;
         column_layout.column_has_no_cells = false;
 
         MinMaxSizes cell_preferred_logical_widths =
@@ -219,6 +229,81 @@ void TableLayoutAlgorithmAuto::FullRecalc() {
     RecalcColumn(i);
 }
 
+bool TableLayoutAlgorithmAuto::AppendRecalc() {
+  unsigned n_eff_cols = table_->NumEffectiveColumns();
+  if (recalc_sections_.IsEmpty() || n_eff_cols != recalc_layout_struct_.size())
+    return false;
+
+  // The sections must be the same, and only the last one may have grown.
+  // Cells which were added, removed or changed in the rows which were already
+  // there are tracked by the sections, see
+  // LayoutTableCell::IntrinsicLogicalWidthsChanged().
+  wtf_size_t section_index = 0;
+  for (LayoutObject* child = table_->Children()->FirstChild(); child;
+       child = child->NextSibling()) {
+    if (!child->IsTableSection())
+      continue;
+    if (section_index == recalc_sections_.size() ||
+        recalc_sections_[section_index] != child)
+      return false;
+    auto* section = To<LayoutTableSection>(child);
+    unsigned old_num_rows = recalc_section_rows_[section_index];
+    if (section->FirstRowWithChangedCellWidths() < old_num_rows ||
+        section->NumRows() < old_num_rows ||
+        (section->NumRows() > old_num_rows &&
+         section_index + 1 != recalc_sections_.size()))
+      return false;
+    section_index++;
+  }
+  if (section_index != recalc_sections_.size())
+    return false;
+
+  // Spanning cells are kept in the order in which a full recalc finds them,
+  // which appended ones would not follow.
+  LayoutTableSection* section = recalc_sections_.back();
+  unsigned first_row = recalc_section_rows_.back();
+  for (unsigned row_index = first_row; row_index < section->NumRows();
+       row_index++) {
+    LayoutTableRow* row = section->RowLayoutObjectAt(row_index);
+    if (!row)
+      continue;
+    for (LayoutTableCell* cell = row->FirstCell(); cell;
+         cell = cell->NextCell()) {
+      if (cell->ColSpan() != 1)
+        return false;
+    }
+  }
+
+  effective_logical_width_dirty_ = true;
+  layout_struct_ = recalc_layout_struct_;
+  if (first_row < section->NumRows()) {
+    for (unsigned i = 0; i < n_eff_cols; i++)
+      RecalcColumn(i, section, first_row);
+  }
+  return true;
+}
+
+void TableLayoutAlgorithmAuto::KeepRecalcState() {
+  recalc_layout_struct_.clear();
+  recalc_sections_.clear();
+  recalc_section_rows_.clear();
+  // Columns set widths which the cells don't know about, and the Nav/IE quirk
+  // in RecalcColumn() depends on cells which AppendRecalc() doesn't see.
+  if (table_->FirstColumn() || table_->GetDocument().InQuirksMode())
+    return;
+
+  recalc_layout_struct_ = layout_struct_;
+  for (LayoutObject* child = table_->Children()->FirstChild(); child;
+       child = child->NextSibling()) {
+    if (!child->IsTableSection())
+      continue;
+    auto* section = To<LayoutTableSection>(child);
+    recalc_sections_.push_back(section);
+    recalc_section_rows_.push_back(section->NumRows());
+    section->ClearRowsWithChangedCellWidths();
+  }
+}
+
 static bool ShouldScaleColumnsForParent(LayoutTable* table) {
   LayoutBlock* cb = table->ContainingBlock();
   // TODO(layout-dev): We can probably abort before reaching LayoutView in many
@@ -295,7 +380,13 @@ void TableLayoutAlgorithmAuto::ComputeIntrinsicLogicalWidths(
     LayoutUnit& max_width) {
   TextAutosizer::TableLayoutScope text_autosizer_table_layout_scope(table_);
 
-  FullRecalc();
+  if (RuntimeEnabledFeatures::IncrementalTableColumnRecalcEnabled()) {
+    if (!AppendRecalc())
+      FullRecalc();
+    KeepRecalcState();
+  } else {
+    FullRecalc();
+  }
 
   int span_max_logical_width = CalcEffectiveLogicalWidth();
   min_width = LayoutUnit();
@@ -929,6 +1020,7 @@ void TableLayoutAlgorithmAuto::ShrinkColumnWidth(
 }
 
 void TableLayoutAlgorithmAuto::Trace(Visitor* visitor) const {
+  visitor->Trace(recalc_sections_);
   visitor->Trace(span_cells_);
   TableLayoutAlgorithm::Trace(visitor);
 }
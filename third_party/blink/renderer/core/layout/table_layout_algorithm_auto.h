@@ -31,6 +31,7 @@ namespace blink {
 
 class LayoutTable;
 class LayoutTableCell;
+class LayoutTableSection;
 
 class TableLayoutAlgorithmAuto final : public TableLayoutAlgorithm {
  public:
@@ -55,7 +56,17 @@ class TableLayoutAlgorithmAuto final : public TableLayoutAlgorithm {
   enum DistributionDirection { kStartToEnd, kEndToStart };
 
   void FullRecalc();
-  void RecalcColumn(unsigned eff_col);
+  // Recalcs the column for the cells of all sections, or only for the cells
+  // which originate in |appended_section| from |first_appended_row| on,
+  // on top of the current values.
+  void RecalcColumn(unsigned eff_col,
+                    LayoutTableSection* appended_section = nullptr,
+                    unsigned first_appended_row = 0);
+  // Recalcs the columns for the rows appended to the last section since
+  // KeepRecalcState(), if nothing else changed. Returns false if a full recalc
+  // is needed.
+  bool AppendRecalc();
+  void KeepRecalcState();
 
   int CalcEffectiveLogicalWidth();
   void ShrinkColumnWidth(const Length::Type&, int& available);
@@ -93,6 +104,13 @@ class TableLayoutAlgorithmAuto final : public TableLayoutAlgorithm {
   };
 
   Vector<Layout, 4> layout_struct_;
+  // With the IncrementalTableColumnRecalc feature, the columns as they were
+  // after the last recalc, before CalcEffectiveLogicalWidth(), and the sections
+  // and their number of rows at that time. Empty if AppendRecalc() can't be
+  // used.
+  Vector<Layout, 4> recalc_layout_struct_;
+  HeapVector<Member<LayoutTableSection>> recalc_sections_;
+  Vector<unsigned> recalc_section_rows_;
   HeapVector<Member<LayoutTableCell>, 4> span_cells_;
   bool has_percent_ : 1;
   mutable bool effective_logical_width_dirty_ : 1;
@@ -56,6 +56,7 @@
 #include "third_party/blink/renderer/core/page/chrome_client.h"
 #include "third_party/blink/renderer/core/page/page.h"
 #include "third_party/blink/renderer/platform/network/network_utils.h"
+#include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/weborigin/security_origin.h"
 #include "ui/gfx/geometry/rect.h"
 
@@ -237,6 +238,26 @@ static bool BlockSuppressesAutosizing(const LayoutBlock* block) {
   return false;
 }
 
+// Returns true if a style change of a block may change whether it or its
+// descendants are classified as INDEPENDENT or SUPPRESSING, i.e. whether their
+// text counts towards the text length of their clusters.
+static bool StyleChangeAffectsTextLength(const ComputedStyle& old_style,
+                                         const ComputedStyle& new_style) {
+  // See IsIndependentDescendant().
+  if (old_style.Display() != new_style.Display() ||
+      old_style.GetPosition() != new_style.GetPosition() ||
+      old_style.Floating() != new_style.Floating() ||
+      old_style.GetWritingMode() != new_style.GetWritingMode() ||
+      old_style.UsedUserModify() != new_style.UsedUserModify()) {
+    return true;
+  }
+  // See BlockSuppressesAutosizing() and BlockHeightConstrained().
+  return old_style.AutoWrap() != new_style.AutoWrap() ||
+         old_style.OverflowY() != new_style.OverflowY() ||
+         old_style.Height() != new_style.Height() ||
+         old_style.MaxHeight() != new_style.MaxHeight();
+}
+
 static bool HasExplicitWidth(const LayoutBlock* block) {
   // FIXME: This heuristic may need to be expanded to other ways a block can be
   // wider or narrower than its parent containing block.
@@ -292,7 +313,10 @@ void TextAutosizer::Record(LayoutBlock* block) {
 }
 
 void TextAutosizer::Record(LayoutText* text) {
-  if (!text || !ShouldHandleLayout())
+  if (!text)
+    return;
+  InvalidateTextLengths(text);
+  if (!ShouldHandleLayout())
     return;
   LayoutObject* parent = GetParent(text);
   if (parent && parent->EverHadLayout())
@@ -300,6 +324,11 @@ void TextAutosizer::Record(LayoutText* text) {
 }
 
 void TextAutosizer::Destroy(LayoutObject* layout_object) {
+  if (layout_object->DocumentBeingDestroyed())
+    text_lengths_.clear();
+  else
+    InvalidateTextLengths(layout_object);
+
   if (!page_info_.setting_enabled_ && !fingerprint_mapper_.HasFingerprints())
     return;
 
@@ -324,6 +353,56 @@ void TextAutosizer::Destroy(LayoutObject* layout_object) {
   }
 }
 
+void TextAutosizer::SpecifiedFontSizeChanged(LayoutText* text) {
+  InvalidateTextLengths(text);
+}
+
+void TextAutosizer::BlockStyleChanged(LayoutBlock* block,
+                                      const ComputedStyle& old_style) {
+  if (text_lengths_.IsEmpty())
+    return;
+  // Other style changes, e.g. of colors or margins, are common on dynamic
+  // pages and keep the text lengths.
+  if (StyleChangeAffectsTextLength(old_style, block->StyleRef())) {
+    // The block may now be independent or suppress autosizing, which changes
+    // the text lengths of its ancestors. It may also constrain the height of
+    // its descendants (see BlockHeightConstrained()), which changes the text
+    // lengths of clusters anywhere in its subtree, so start over.
+    text_lengths_.clear();
+  }
+}
+
+void TextAutosizer::InsertedIntoTree(LayoutObject* layout_object) {
+  InvalidateTextLengths(layout_object);
+  // A subtree which is moved to another parent may get a new height
+  // constraint from its new ancestors.
+  InvalidateDescendantTextLengths(layout_object);
+}
+
+void TextAutosizer::WillBeRemovedFromTree(LayoutObject* layout_object) {
+  InvalidateTextLengths(layout_object);
+}
+
+void TextAutosizer::InvalidateTextLengths(const LayoutObject* object) {
+  if (text_lengths_.IsEmpty())
+    return;
+  for (; object; object = object->Parent()) {
+    if (auto* block = DynamicTo<LayoutBlock>(object))
+      text_lengths_.erase(block);
+  }
+}
+
+void TextAutosizer::InvalidateDescendantTextLengths(
+    const LayoutObject* object) {
+  if (text_lengths_.IsEmpty() || !object->SlowFirstChild())
+    return;
+  for (const LayoutObject* descendant = object->SlowFirstChild(); descendant;
+       descendant = descendant->NextInPreOrder(object)) {
+    if (auto* block = DynamicTo<LayoutBlock>(descendant))
+      text_lengths_.erase(block);
+  }
+}
+
 TextAutosizer::BeginLayoutBehavior TextAutosizer::PrepareForLayout(
     LayoutBlock* block) {
 #if DCHECK_IS_ON()
@@ -812,6 +891,24 @@ bool TextAutosizer::ClusterHasEnoughTextToAutosize(
             .width();
   }
 
+  // The text length only depends on the subtree of the root, so it can be
+  // reused until text is inserted, changed or removed below the root.
+  bool use_cached_length =
+      RuntimeEnabledFeatures::IncrementalTextAutosizerClustersEnabled();
+  if (use_cached_length) {
+    auto it = text_lengths_.find(root);
+    if (it != text_lengths_.end()) {
+      if (it->value.length_ >= minimum_text_length_to_autosize) {
+        cluster->has_enough_text_to_autosize_ = kHasEnoughText;
+        return true;
+      }
+      if (it->value.is_complete_) {
+        cluster->has_enough_text_to_autosize_ = kNotEnoughText;
+        return false;
+      }
+    }
+  }
+
   float length = 0;
   LayoutObject* descendant = root->FirstChild();
   while (descendant) {
@@ -830,6 +927,8 @@ bool TextAutosizer::ClusterHasEnoughTextToAutosize(
           descendant->StyleRef().SpecifiedFontSize();
 
       if (length >= minimum_text_length_to_autosize) {
+        if (use_cached_length)
+          text_lengths_.Set(root, TextLength{length, false});
         cluster->has_enough_text_to_autosize_ = kHasEnoughText;
         return true;
       }
@@ -837,6 +936,8 @@ bool TextAutosizer::ClusterHasEnoughTextToAutosize(
     descendant = descendant->NextInPreOrder(root);
   }
 
+  if (use_cached_length)
+    text_lengths_.Set(root, TextLength{length, true});
   cluster->has_enough_text_to_autosize_ = kNotEnoughText;
   return false;
 }
@@ -1580,6 +1681,7 @@ void TextAutosizer::Trace(Visitor* visitor) const {
 #endif
   visitor->Trace(cluster_stack_);
   visitor->Trace(fingerprint_mapper_);
+  visitor->Trace(text_lengths_);
 }
 
 void TextAutosizer::FingerprintMapper::Trace(Visitor* visitor) const {
@@ -48,6 +48,7 @@ class Size;
 
 namespace blink {
 
+class ComputedStyle;
 class Document;
 class Frame;
 class LayoutBlock;
@@ -95,6 +96,16 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
   void Record(LayoutBlock*);
   void Record(LayoutText*);
   void Destroy(LayoutObject*);
+  // Called when the specified font size of an existing text changes, which
+  // changes the text length of its clusters.
+  void SpecifiedFontSizeChanged(LayoutText*);
+  // Called when the style of an existing block changes, which may change
+  // which of its descendants suppress autosizing.
+  void BlockStyleChanged(LayoutBlock*, const ComputedStyle& old_style);
+  // Called when an object is inserted into or removed from the layout tree,
+  // which changes the text lengths of the clusters containing it.
+  void InsertedIntoTree(LayoutObject*);
+  void WillBeRemovedFromTree(LayoutObject*);
 
   bool PageNeedsAutosizing() const;
 
@@ -146,6 +157,19 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
   typedef HeapHashSet<Member<LayoutBlock>> BlockSet;
   typedef HeapHashSet<Member<const LayoutBlock>> ConstBlockSet;
 
+  // The text length of a cluster root as computed by
+  // ClusterHasEnoughTextToAutosize(). The computation stops as soon as the
+  // text is long enough to autosize, in which case |is_complete_| is false and
+  // |length_| is only a lower bound.
+  struct TextLength {
+    DISALLOW_NEW();
+
+   public:
+    float length_ = 0;
+    bool is_complete_ = false;
+  };
+  typedef HeapHashMap<Member<const LayoutBlock>, TextLength> TextLengthMap;
+
   enum HasEnoughTextToAutosize {
     kUnknownAmountOfText,
     kHasEnoughText,
@@ -368,6 +392,10 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
   void CheckSuperclusterConsistency();
   // Mark the nearest non-inheritance supercluser
   void MarkSuperclusterForConsistencyCheck(LayoutObject*);
+  // Drops the cached text lengths of the object and its ancestors.
+  void InvalidateTextLengths(const LayoutObject*);
+  // Drops the cached text lengths of the descendants of the object.
+  void InvalidateDescendantTextLengths(const LayoutObject*);
 
   void ReportIfCrossSiteFrame();
 
@@ -382,6 +410,9 @@ class CORE_EXPORT TextAutosizer final : public GarbageCollected<TextAutosizer> {
   // Clusters are created and destroyed during layout
   ClusterStack cluster_stack_;
   FingerprintMapper fingerprint_mapper_;
+  // Text lengths of cluster roots, which persist across layouts so that only
+  // the clusters with inserted, changed or removed text are measured again.
+  TextLengthMap text_lengths_;
   // FIXME: All frames should share the same m_pageInfo instance.
   PageInfo page_info_;
   bool update_page_info_deferred_;
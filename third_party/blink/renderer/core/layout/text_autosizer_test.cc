@@ -12,6 +12,7 @@
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_request.h"
 #include "third_party/blink/renderer/core/testing/sim/sim_test.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
 #include "ui/gfx/geometry/rect.h"
 
@@ -742,6 +743,133 @@ TEST_F(TextAutosizerTest, ChangingInheritedClusterTextInsideSuperCluster) {
   EXPECT_FLOAT_EQ(28.f, short_text->StyleRef().ComputedFontSize());
 }
 
+TEST_F(TextAutosizerTest, GrowingSuperClusterWithCachedTextLengths) {
+  ScopedIncrementalTextAutosizerClustersForTest incremental_clusters(true);
+  SetBodyInnerHTML(R"HTML(
+    <meta name='viewport' content='width=800'>
+    <style>
+      html { font-size: 16px; }
+      body { width: 800px; margin: 0; overflow-y: hidden; }
+      .supercluster { width:560px; }
+    </style>
+    <div class='supercluster'>
+      <div id='growingText'>short blah blah</div>
+    </div>
+    <div class='supercluster'>
+      <div id='shortText'>short blah blah</div>
+    </div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  // The cached text length of a cluster root must be dropped when text is
+  // appended to it, so that the text is measured again.
+  Element* growing_text_element = GetDocument().getElementById("growingText");
+  auto append_sentence = [&]() {
+    growing_text_element->insertAdjacentHTML(
+        "beforeend",
+        "<span>Lorem ipsum dolor sit amet, consectetur adipisicing "
+        "elit.</span>",
+        ASSERT_NO_EXCEPTION);
+    UpdateAllLifecyclePhasesForTest();
+  };
+  append_sentence();
+  append_sentence();
+
+  LayoutObject* growing_text = growing_text_element->GetLayoutObject();
+  LayoutObject* short_text =
+      GetDocument().getElementById("shortText")->GetLayoutObject();
+  EXPECT_FLOAT_EQ(16.f, growing_text->StyleRef().ComputedFontSize());
+  EXPECT_FLOAT_EQ(16.f, short_text->StyleRef().ComputedFontSize());
+
+  append_sentence();
+  //(specified font-size = 16px) * (block width = 560px) /
+  // (window width = 320px) = 28px.
+  EXPECT_FLOAT_EQ(28.f, growing_text->StyleRef().ComputedFontSize());
+  EXPECT_FLOAT_EQ(28.f, short_text->StyleRef().ComputedFontSize());
+}
+
+TEST_F(TextAutosizerTest, AppendTextToShortClusterWithCachedTextLengths) {
+  ScopedIncrementalTextAutosizerClustersForTest incremental_clusters(true);
+  SetBodyInnerHTML(R"HTML(
+    <meta name='viewport' content='width=800'>
+    <style>
+      html { font-size: 16px; }
+      body { width: 800px; margin: 0; overflow-y: hidden; }
+      .cluster { width:560px; }
+    </style>
+    <div class='cluster' id='cluster'>short blah blah</div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  Element* cluster = GetDocument().getElementById("cluster");
+  LayoutObject* short_text = cluster->firstChild()->GetLayoutObject();
+  EXPECT_FLOAT_EQ(16.f, short_text->StyleRef().ComputedFontSize());
+
+  // The text is inserted into the layout tree after its style is set, so the
+  // cluster measured as too short must be measured again on insertion.
+  cluster->appendChild(GetDocument().createTextNode(
+      "    Lorem ipsum dolor sit amet, consectetur adipisicing elit, sed "
+      "do eiusmod tempor"
+      "    incididunt ut labore et dolore magna aliqua. Ut enim ad minim "
+      "veniam, quis nostrud"
+      "    exercitation ullamco laboris nisi ut aliquip ex ea commodo "
+      "consequat. Duis aute irure"
+      "    dolor in reprehenderit in voluptate velit esse cillum dolore eu "
+      "fugiat nulla pariatur."));
+  UpdateAllLifecyclePhasesForTest();
+
+  //(specified font-size = 16px) * (block width = 560px) /
+  // (window width = 320px) = 28px.
+  EXPECT_FLOAT_EQ(28.f, short_text->StyleRef().ComputedFontSize());
+  LayoutObject* appended_text = cluster->lastChild()->GetLayoutObject();
+  EXPECT_FLOAT_EQ(28.f, appended_text->StyleRef().ComputedFontSize());
+}
+
+TEST_F(TextAutosizerTest, HeightConstraintWithCachedTextLengths) {
+  ScopedIncrementalTextAutosizerClustersForTest incremental_clusters(true);
+  SetBodyInnerHTML(R"HTML(
+    <meta name='viewport' content='width=800'>
+    <style>
+      html { font-size: 16px; }
+      body { width: 800px; margin: 0; overflow-y: hidden; }
+      .cluster { width:560px; }
+      .constrained { height: 100px; }
+    </style>
+    <div class='cluster'>
+      <div id='short'>short blah blah</div>
+      <div id='long'>
+        Lorem ipsum dolor sit amet, consectetur adipisicing elit, sed do
+        eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad
+        minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip
+        ex ea commodo consequat. Duis aute irure dolor in reprehenderit in
+        voluptate velit esse cillum dolore eu fugiat nulla pariatur.
+      </div>
+    </div>
+  )HTML");
+  UpdateAllLifecyclePhasesForTest();
+
+  Element* short_element = GetDocument().getElementById("short");
+  LayoutObject* short_text = short_element->firstChild()->GetLayoutObject();
+  //(specified font-size = 16px) * (block width = 560px) /
+  // (window width = 320px) = 28px.
+  EXPECT_FLOAT_EQ(28.f, short_text->StyleRef().ComputedFontSize());
+
+  // A height constraint suppresses autosizing of the long text, which then
+  // no longer counts towards the text length of the cluster. The padding of
+  // the short text only makes sure that it is laid out again, and does not
+  // change the text length.
+  Element* long_element = GetDocument().getElementById("long");
+  long_element->setAttribute(html_names::kClassAttr, "constrained");
+  short_element->setAttribute(html_names::kStyleAttr, "padding-left: 1px");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_FLOAT_EQ(16.f, short_text->StyleRef().ComputedFontSize());
+
+  long_element->removeAttribute(html_names::kClassAttr);
+  short_element->setAttribute(html_names::kStyleAttr, "padding-left: 2px");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_FLOAT_EQ(28.f, short_text->StyleRef().ComputedFontSize());
+}
+
 TEST_F(TextAutosizerTest, AutosizeInnerContentOfRuby) {
   SetBodyInnerHTML(R"HTML(
     <meta name='viewport' content='width=800'>
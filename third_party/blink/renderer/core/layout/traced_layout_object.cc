@@ -6,6 +6,7 @@
 
 #include <inttypes.h>
 #include <memory>
+#include "third_party/blink/renderer/core/layout/layout_box.h"
 #include "third_party/blink/renderer/core/layout/layout_inline.h"
 #include "third_party/blink/renderer/core/layout/layout_table_cell.h"
 #include "third_party/blink/renderer/core/layout/layout_text.h"
@@ -107,6 +108,17 @@ void DumpToTracedValue(const LayoutObject& object,
   }
 }
 
+void SetClassStats(const char* name,
+                   wtf_size_t count,
+                   size_t object_size,
+                   TracedValue* traced_value) {
+  traced_value->BeginDictionary(name);
+  traced_value->SetInteger("count", static_cast<int>(count));
+  traced_value->SetDouble("bytesLowerBound",
+                          static_cast<double>(count) * object_size);
+  traced_value->EndDictionary();
+}
+
 }  // namespace
 
 std::unique_ptr<TracedValue> TracedLayoutObject::Create(const LayoutView& view,
@@ -116,4 +128,37 @@ std::unique_ptr<TracedValue> TracedLayoutObject::Create(const LayoutView& view,
   return traced_value;
 }
 
+std::unique_ptr<TracedValue> TracedLayoutObject::CreateMemoryStats(
+    const LayoutView& view) {
+  // Each entry counts the objects of the class and of all its subclasses, but
+  // the sizes of the subclasses are not known here. So the bytes are a lower
+  // bound, which is enough to compare the sizes of the common fields.
+  wtf_size_t other_object_count = 0;
+  wtf_size_t box_count = 0;
+  wtf_size_t text_count = 0;
+  wtf_size_t box_rare_data_count = 0;
+  for (const LayoutObject* object = &view; object;
+       object = object->NextInPreOrder()) {
+    if (const auto* box = DynamicTo<LayoutBox>(object)) {
+      ++box_count;
+      if (box->HasRareData())
+        ++box_rare_data_count;
+    } else if (object->IsText()) {
+      ++text_count;
+    } else {
+      ++other_object_count;
+    }
+  }
+
+  auto traced_value = std::make_unique<TracedValue>();
+  SetClassStats("OtherLayoutObject", other_object_count, sizeof(LayoutObject),
+                traced_value.get());
+  SetClassStats("LayoutBox", box_count, sizeof(LayoutBox), traced_value.get());
+  SetClassStats("LayoutText", text_count, sizeof(LayoutText),
+                traced_value.get());
+  SetClassStats("LayoutBoxRareData", box_rare_data_count,
+                sizeof(LayoutBoxRareData), traced_value.get());
+  return traced_value;
+}
+
 }  // namespace blink
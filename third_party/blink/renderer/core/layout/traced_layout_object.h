@@ -16,6 +16,10 @@ class TracedLayoutObject {
  public:
   static std::unique_ptr<TracedValue> Create(const LayoutView&,
                                              bool trace_geometry = true);
+  // Counts the LayoutBoxes, LayoutTexts and other layout objects of the tree,
+  // and the LayoutBoxRareData of the boxes, with a lower bound of the bytes
+  // which they take.
+  static std::unique_ptr<TracedValue> CreateMemoryStats(const LayoutView&);
 };
 
 }  // namespace blink
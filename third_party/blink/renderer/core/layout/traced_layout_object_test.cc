@@ -0,0 +1,92 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/traced_layout_object.h"
+
+#include "base/values.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/layout/layout_box.h"
+#include "third_party/blink/renderer/core/layout/layout_text.h"
+#include "third_party/blink/renderer/core/layout/layout_view.h"
+#include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
+
+namespace blink {
+
+namespace {
+
+class TracedLayoutObjectTest : public RenderingTest {
+ protected:
+  base::Value::Dict MemoryStats() {
+    return TracedLayoutObject::CreateMemoryStats(GetLayoutView())
+        ->ToBaseValue()
+        ->GetDict()
+        .Clone();
+  }
+};
+
+class TracedLayoutObjectLegacyTest : public TracedLayoutObjectTest,
+                                     private ScopedLayoutNGForTest {
+ public:
+  // Only legacy layout has inline box wrappers.
+  TracedLayoutObjectLegacyTest() : ScopedLayoutNGForTest(false) {}
+};
+
+int Count(const base::Value::Dict& stats, const char* name) {
+  return *stats.FindDict(name)->FindInt("count");
+}
+
+size_t BytesLowerBound(const base::Value::Dict& stats, const char* name) {
+  return static_cast<size_t>(
+      *stats.FindDict(name)->FindDouble("bytesLowerBound"));
+}
+
+}  // namespace
+
+TEST_F(TracedLayoutObjectTest, MemoryStats) {
+  SetBodyInnerHTML("<div id=container></div>");
+  base::Value::Dict stats = MemoryStats();
+  int boxes = Count(stats, "LayoutBox");
+  int texts = Count(stats, "LayoutText");
+  int others = Count(stats, "OtherLayoutObject");
+
+  // Two block boxes with text in inline boxes.
+  GetElementById("container")
+      ->setInnerHTML(
+          "<div><span>foo</span></div><div><span>bar</span><span>baz</span>"
+          "</div>");
+  UpdateAllLifecyclePhasesForTest();
+  stats = MemoryStats();
+  EXPECT_EQ(boxes + 2, Count(stats, "LayoutBox"));
+  EXPECT_EQ(texts + 3, Count(stats, "LayoutText"));
+  EXPECT_EQ(others + 3, Count(stats, "OtherLayoutObject"));
+
+  // The bytes are the count times the size of the class, which is a lower
+  // bound for the subclasses.
+  EXPECT_EQ(Count(stats, "LayoutBox") * sizeof(LayoutBox),
+            BytesLowerBound(stats, "LayoutBox"));
+  EXPECT_EQ(Count(stats, "LayoutText") * sizeof(LayoutText),
+            BytesLowerBound(stats, "LayoutText"));
+  EXPECT_EQ(Count(stats, "OtherLayoutObject") * sizeof(LayoutObject),
+            BytesLowerBound(stats, "OtherLayoutObject"));
+  EXPECT_EQ(Count(stats, "LayoutBoxRareData") * sizeof(LayoutBoxRareData),
+            BytesLowerBound(stats, "LayoutBoxRareData"));
+}
+
+TEST_F(TracedLayoutObjectLegacyTest, MemoryStatsRareData) {
+  SetBodyInnerHTML("<div id=container>foo</div>");
+  int rare_data = Count(MemoryStats(), "LayoutBoxRareData");
+
+  // Atomic inlines in legacy inline layout keep their inline box wrapper in
+  // the rare data.
+  GetElementById("container")
+      ->setInnerHTML("foo<span id=target style='display: inline-block'>bar"
+                     "</span>");
+  UpdateAllLifecyclePhasesForTest();
+  EXPECT_TRUE(
+      To<LayoutBox>(GetLayoutObjectByElementId("target"))->HasRareData());
+  EXPECT_LT(rare_data, Count(MemoryStats(), "LayoutBoxRareData"));
+}
+
+}  // namespace blink
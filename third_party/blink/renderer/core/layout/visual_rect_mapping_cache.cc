@@ -0,0 +1,67 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
+
+#include "third_party/blink/renderer/core/layout/layout_box_model_object.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
+
+namespace blink {
+
+bool VisualRectMappingCache::Find(const LayoutObject& object,
+                                  const LayoutBoxModelObject& ancestor,
+                                  VisualRectFlags flags,
+                                  PhysicalRect& rect,
+                                  bool& intersects) const {
+  auto ancestor_it = mappings_.find(&ancestor);
+  if (ancestor_it == mappings_.end())
+    return false;
+  auto it = ancestor_it->value->find(&object);
+  if (it == ancestor_it->value->end())
+    return false;
+  for (const Mapping& mapping : it->value) {
+    if (mapping.flags == flags && mapping.input_rect == rect) {
+      rect = mapping.mapped_rect;
+      intersects = mapping.intersects;
+      return true;
+    }
+  }
+  return false;
+}
+
+void VisualRectMappingCache::Add(const LayoutObject& object,
+                                 const LayoutBoxModelObject& ancestor,
+                                 VisualRectFlags flags,
+                                 const PhysicalRect& input_rect,
+                                 const PhysicalRect& mapped_rect,
+                                 bool intersects) {
+  auto ancestor_result = mappings_.insert(&ancestor, nullptr);
+  if (ancestor_result.is_new_entry) {
+    ancestor_result.stored_value->value =
+        MakeGarbageCollected<ObjectMappings>();
+  }
+  MappingVector& mappings =
+      ancestor_result.stored_value->value->insert(&object, MappingVector())
+          .stored_value->value;
+  if (mappings.size() == kMaxMappingsPerObject)
+    mappings.EraseAt(0);
+  mappings.push_back(Mapping{flags, input_rect, mapped_rect, intersects});
+}
+
+void VisualRectMappingCache::Remove(const LayoutObject& object) {
+  if (mappings_.IsEmpty())
+    return;
+  if (const auto* box_model = DynamicTo<LayoutBoxModelObject>(object))
+    mappings_.erase(box_model);
+  HeapVector<Member<const LayoutBoxModelObject>> unused_ancestors;
+  for (auto& entry : mappings_) {
+    entry.value->erase(&object);
+    if (entry.value->IsEmpty())
+      unused_ancestors.push_back(entry.key);
+  }
+  for (const auto& ancestor : unused_ancestors)
+    mappings_.erase(ancestor);
+}
+
+}  // namespace blink
@@ -0,0 +1,74 @@
+// Copyright 2022 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_VISUAL_RECT_MAPPING_CACHE_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_VISUAL_RECT_MAPPING_CACHE_H_
+
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/layout/geometry/physical_rect.h"
+#include "third_party/blink/renderer/core/layout/layout_object.h"
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/member.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class LayoutBoxModelObject;
+
+// Memoizes the results of LayoutObject::MapToVisualRectInAncestorSpace() with
+// kUseGeometryMapper for the layout objects of one frame. The results only
+// depend on paint offsets and paint properties, so the owning LocalFrameView
+// clears the cache whenever those may have changed.
+class CORE_EXPORT VisualRectMappingCache final
+    : public GarbageCollected<VisualRectMappingCache> {
+ public:
+  // If the mapping of |rect| from |object| to |ancestor| with |flags| is
+  // cached, updates |rect| and |intersects| with it and returns true.
+  bool Find(const LayoutObject& object,
+            const LayoutBoxModelObject& ancestor,
+            VisualRectFlags flags,
+            PhysicalRect& rect,
+            bool& intersects) const;
+
+  void Add(const LayoutObject& object,
+           const LayoutBoxModelObject& ancestor,
+           VisualRectFlags flags,
+           const PhysicalRect& input_rect,
+           const PhysicalRect& mapped_rect,
+           bool intersects);
+
+  // Drops the mappings of |object|, and those to |object| as the ancestor.
+  void Remove(const LayoutObject& object);
+
+  void Clear() { mappings_.clear(); }
+  bool IsEmpty() const { return mappings_.IsEmpty(); }
+
+  void Trace(Visitor* visitor) const { visitor->Trace(mappings_); }
+
+ private:
+  struct Mapping {
+    VisualRectFlags flags;
+    PhysicalRect input_rect;
+    PhysicalRect mapped_rect;
+    bool intersects;
+  };
+
+  // Callers usually map only one or two rects of an object, so a few mappings
+  // per object and ancestor are enough.
+  static constexpr wtf_size_t kMaxMappingsPerObject = 4;
+
+  using MappingVector = Vector<Mapping, kMaxMappingsPerObject>;
+  using ObjectMappings =
+      HeapHashMap<Member<const LayoutObject>, MappingVector>;
+
+  // Keyed by the ancestor first, since callers map to only a few ancestors,
+  // such as the LayoutView or the root of an intersection observer.
+  HeapHashMap<Member<const LayoutBoxModelObject>, Member<ObjectMappings>>
+      mappings_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_LAYOUT_VISUAL_RECT_MAPPING_CACHE_H_
@@ -3,14 +3,17 @@
 // found in the LICENSE file.
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/html_names.h"
 #include "third_party/blink/renderer/core/layout/layout_embedded_content.h"
 #include "third_party/blink/renderer/core/layout/layout_view.h"
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
 #include "third_party/blink/renderer/core/paint/paint_layer.h"
 #include "third_party/blink/renderer/core/paint/paint_layer_scrollable_area.h"
 #include "third_party/blink/renderer/core/paint/paint_property_tree_printer.h"
 #include "third_party/blink/renderer/core/testing/core_unit_test_helper.h"
 #include "third_party/blink/renderer/platform/graphics/paint/geometry_mapper.h"
 #include "third_party/blink/renderer/platform/testing/paint_test_configurations.h"
+#include "third_party/blink/renderer/platform/testing/runtime_enabled_features_test_helpers.h"
 
 namespace blink {
 
@@ -1392,4 +1395,73 @@ TEST_P(VisualRectMappingTest, AnchorScroll) {
                   PhysicalRect(100, 50, 50, 50));
 }
 
+TEST_P(VisualRectMappingTest, CachedGeometryMapperMapping) {
+  ScopedCachedVisualRectMappingForTest cached_visual_rect_mapping(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>body { margin: 0; }</style>
+    <div id=container style='transform: translateX(10px)'>
+      <div id=target style='width: 100px; height: 100px'></div>
+    </div>
+  )HTML");
+
+  const LayoutBox* target = GetLayoutBoxByElementId("target");
+  PhysicalRect rect(0, 0, 100, 100);
+  CheckMapToVisualRectInAncestorSpace(rect, PhysicalRect(10, 0, 100, 100),
+                                      target, &GetLayoutView(),
+                                      kDefaultVisualRectFlags, true);
+  // Mapping the same rect again returns the cached result.
+  CheckMapToVisualRectInAncestorSpace(rect, PhysicalRect(10, 0, 100, 100),
+                                      target, &GetLayoutView(),
+                                      kDefaultVisualRectFlags, true);
+
+  // Updating the transform clears the cached result.
+  GetDocument()
+      .getElementById("container")
+      ->setAttribute(html_names::kStyleAttr, "transform: translateX(20px)");
+  UpdateAllLifecyclePhasesForTest();
+  CheckMapToVisualRectInAncestorSpace(rect, PhysicalRect(20, 0, 100, 100),
+                                      target, &GetLayoutView(),
+                                      kDefaultVisualRectFlags, true);
+}
+
+TEST_P(VisualRectMappingTest, CachedGeometryMapperMappingOfDestroyedObject) {
+  ScopedCachedVisualRectMappingForTest cached_visual_rect_mapping(true);
+  SetBodyInnerHTML(R"HTML(
+    <style>body { margin: 0; }</style>
+    <div id=container style='transform: translateX(10px)'>
+      <div id=target style='width: 100px; height: 100px'></div>
+    </div>
+    <div id=other style='position: relative; width: 100px; height: 100px'>
+    </div>
+  )HTML");
+
+  const auto* container =
+      To<LayoutBoxModelObject>(GetLayoutObjectByElementId("container"));
+  const LayoutBox* target = GetLayoutBoxByElementId("target");
+  const LayoutBox* other = GetLayoutBoxByElementId("other");
+  PhysicalRect rect(0, 0, 100, 100);
+  CheckMapToVisualRectInAncestorSpace(rect, PhysicalRect(0, 0, 100, 100),
+                                      target, container,
+                                      kDefaultVisualRectFlags, true);
+  CheckMapToVisualRectInAncestorSpace(rect, PhysicalRect(0, 100, 100, 100),
+                                      other, &GetLayoutView(),
+                                      kDefaultVisualRectFlags, true);
+
+  // Destroying the container drops the mappings to it and from its
+  // descendants, but keeps the others.
+  VisualRectMappingCache& cache =
+      GetDocument().View()->GetVisualRectMappingCache();
+  GetDocument().getElementById("container")->remove();
+  GetDocument().UpdateStyleAndLayoutTree();
+  PhysicalRect mapped_rect = rect;
+  bool intersects = false;
+  EXPECT_TRUE(cache.Find(*other, GetLayoutView(), kUseGeometryMapper,
+                         mapped_rect, intersects));
+  EXPECT_EQ(PhysicalRect(0, 100, 100, 100), mapped_rect);
+
+  GetDocument().getElementById("other")->remove();
+  GetDocument().UpdateStyleAndLayoutTree();
+  EXPECT_TRUE(cache.IsEmpty());
+}
+
 }  // namespace blink
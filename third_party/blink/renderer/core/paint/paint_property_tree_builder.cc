@@ -41,6 +41,7 @@
 #include "third_party/blink/renderer/core/layout/svg/svg_layout_support.h"
 #include "third_party/blink/renderer/core/layout/svg/svg_resources.h"
 #include "third_party/blink/renderer/core/layout/svg/transform_helper.h"
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
 #include "third_party/blink/renderer/core/page/link_highlight.h"
 #include "third_party/blink/renderer/core/page/page.h"
 #include "third_party/blink/renderer/core/page/scrolling/snap_coordinator.h"
@@ -4199,6 +4200,7 @@ void PaintPropertyTreeBuilder::DirectlyUpdateTransformMatrix(
   // GeometryMapper depends on paint properties. This is typically called from
   // the PrePaintTreeWalk, but we may skip that for this direct update.
   GeometryMapper::ClearCache();
+  object.GetFrameView()->GetVisualRectMappingCache().Clear();
 
   auto& box = To<LayoutBox>(object);
   PhysicalSize size = PhysicalSize(box.Size());
@@ -21,6 +21,7 @@
 #include "third_party/blink/renderer/core/layout/ng/ng_block_break_token.h"
 #include "third_party/blink/renderer/core/layout/ng/ng_fragmentation_utils.h"
 #include "third_party/blink/renderer/core/layout/ng/ng_physical_box_fragment.h"
+#include "third_party/blink/renderer/core/layout/visual_rect_mapping_cache.h"
 #include "third_party/blink/renderer/core/page/chrome_client.h"
 #include "third_party/blink/renderer/core/page/link_highlight.h"
 #include "third_party/blink/renderer/core/page/page.h"
@@ -59,8 +60,13 @@ void PrePaintTreeWalk::WalkTree(LocalFrameView& root_frame_view) {
   // GeometryMapper depends on paint properties.
   bool needs_tree_builder_context_update =
       NeedsTreeBuilderContextUpdate(root_frame_view, context);
-  if (needs_tree_builder_context_update)
+  if (needs_tree_builder_context_update) {
     GeometryMapper::ClearCache();
+    root_frame_view.ForAllNonThrottledLocalFrameViews(
+        [](LocalFrameView& frame_view) {
+          frame_view.GetVisualRectMappingCache().Clear();
+        });
+  }
 
   VisualViewport& visual_viewport =
       root_frame_view.GetPage()->GetVisualViewport();